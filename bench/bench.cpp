@@ -0,0 +1,240 @@
+/**
+ * @file bench.cpp
+ * @brief Micro-benchmarks of the engine hot paths, reported as JSON
+ * @author ayrto
+ * @date 2025
+ *
+ * Each case is repeated until it has run for at least --min-time seconds
+ * and the mean time per operation is reported. Results go to stdout (or
+ * --out FILE) as one JSON document so releases can be compared by scripts.
+ */
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Board.h"
+#include "Game.h"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief One measured case
+     */
+    struct Result
+    {
+        std::string name;
+        int columns{0};
+        int rows{0};
+        double density{0};
+        std::uint64_t iterations{0};
+        double nsPerOp{0};
+        std::string skipped; ///< Why the case was not run (empty when measured)
+    };
+
+    /**
+     * @brief Stream buffer that discards everything, so printing measures formatting only
+     */
+    class NullBuffer : public std::streambuf
+    {
+    protected:
+        int overflow(int c) override { return traits_type::not_eof(c); }
+        std::streamsize xsputn(const char *, std::streamsize count) override { return count; }
+    };
+
+    volatile std::int64_t sink = 0; ///< Keeps measured results alive
+
+    double minTime = 0.2; ///< Seconds each case runs at least
+
+    /**
+     * @brief Times `body` (not `setup`) until minTime has been spent in it
+     * @param opsPerRun Operations performed by one call of body
+     */
+    template <typename Setup, typename Body>
+    Result measure(std::string name, int columns, int rows, double density, int opsPerRun, Setup setup, Body body)
+    {
+        Result result{std::move(name), columns, rows, density, 0, 0, {}};
+        Clock::duration spent{};
+        std::uint64_t runs = 0;
+
+        do
+        {
+            setup();
+            const auto begin = Clock::now();
+            body();
+            spent += Clock::now() - begin;
+            ++runs;
+        } while (std::chrono::duration<double>(spent).count() < minTime || runs < 3);
+
+        result.iterations = runs * static_cast<std::uint64_t>(opsPerRun);
+        result.nsPerOp = std::chrono::duration<double, std::nano>(spent).count() / static_cast<double>(result.iterations);
+        std::cerr << result.name << " " << columns << "x" << rows << " @" << density << ": " << result.nsPerOp
+                  << " ns/op\n";
+        return result;
+    }
+
+    /**
+     * @brief Records a case that was not run, so the JSON lists it instead of silently omitting it
+     */
+    Result skip(std::string name, int columns, int rows, double density, std::string reason)
+    {
+        std::cerr << name << " " << columns << "x" << rows << " @" << density << ": skipped (" << reason << ")\n";
+        return Result{std::move(name), columns, rows, density, 0, 0, std::move(reason)};
+    }
+
+    int minesFor(int columns, int rows, double density)
+    {
+        return static_cast<int>(static_cast<double>(columns) * rows * density);
+    }
+
+    void writeJson(std::ostream &out, const std::vector<Result> &results)
+    {
+        out << "{\n  \"context\": {\"hardware_threads\": " << std::thread::hardware_concurrency()
+            << ", \"min_time_s\": " << minTime << "},\n  \"benchmarks\": [\n";
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const Result &r = results[i];
+            out << "    {\"name\": \"" << r.name << "\", \"columns\": " << r.columns << ", \"rows\": " << r.rows
+                << ", \"density\": " << r.density;
+            if (r.skipped.empty())
+                out << ", \"iterations\": " << r.iterations << ", \"ns_per_op\": " << r.nsPerOp;
+            else
+                out << ", \"skipped\": \"" << r.skipped << "\"";
+            out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+}
+
+/**
+ * @brief Runs every benchmark case
+ *
+ * Accepted arguments (all optional):
+ * - `--min-time S`: seconds spent in each case (default 0.2)
+ * - `--max-size N`: largest board side measured (default 4096)
+ * - `--out FILE`: write the JSON there instead of stdout
+ *
+ * @return 0 on success, 1 on invalid arguments or unwritable output
+ */
+int main(int argc, char *argv[]) {
+    int maxSize = 4096;
+    std::string outPath;
+
+    for (int i = 1; i < argc; i += 2) {
+        const std::string_view argument(argv[i]);
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << argument << "\n";
+            return 1;
+        }
+        try {
+            if (argument == "--min-time")
+                minTime = std::stod(argv[i + 1]);
+            else if (argument == "--max-size")
+                maxSize = std::stoi(argv[i + 1]);
+            else if (argument == "--out")
+                outPath = argv[i + 1];
+            else
+                throw std::invalid_argument(argv[i]);
+        } catch (const std::exception &) {
+            std::cerr << "Invalid argument " << argument << "\n";
+            return 1;
+        }
+    }
+
+    constexpr std::array sizes{9, 16, 64, 256, 1024, 4096};
+    constexpr std::array densities{0.10, 0.15625, 0.20};
+    constexpr int maxPrintSize = 1024; // A 4096x4096 print formats 16M cells, seconds per call
+    std::vector<Result> results;
+    std::uint64_t seed = 1;
+
+    for (const int size : sizes) {
+        if (size > maxSize)
+            break;
+
+        // Board construction (setMines + setNumber) at every density
+        for (const double density : densities) {
+            const int mines = minesFor(size, size, density);
+            results.push_back(measure("board_construction", size, size, density, 1, [] {}, [&] {
+                Board board(size, size, mines, ++seed);
+                sink = sink + board.getRevealedSafeCount();
+            }));
+        }
+
+        // Worst-case flood fill: an empty board opens completely from one click
+        {
+            Game game(size, size, 0, seed);
+            results.push_back(measure("reveal_flood_fill", size, size, 0.0, 1, [&] { game.reset(++seed); }, [&] {
+                sink = sink + game.revealCellAndPropagate(0, 0);
+            }));
+        }
+
+        // Status queries, which run after every move
+        {
+            Game game(size, size, minesFor(size, size, 0.15625), seed);
+            game.play(size / 2, size / 2, 'R');
+            constexpr int calls = 1000;
+            results.push_back(measure("check_win_condition", size, size, 0.15625, calls, [] {}, [&] {
+                for (int i = 0; i < calls; ++i)
+                    game.checkWinCondition();
+                sink = sink + game.isPlaying();
+            }));
+            results.push_back(measure("get_flags_count", size, size, 0.15625, calls, [] {}, [&] {
+                for (int i = 0; i < calls; ++i)
+                    sink = sink + game.getFlagsCount();
+            }));
+            results.push_back(measure("get_revealed_count", size, size, 0.15625, calls, [] {}, [&] {
+                for (int i = 0; i < calls; ++i)
+                    sink = sink + game.getRevealedCount();
+            }));
+        }
+
+        // Rendering into a discarding stream, after an opening and a row of flags
+        if (size > maxPrintSize) {
+            results.push_back(skip("board_print", size, size, 0.15625,
+                                   "boards above " + std::to_string(maxPrintSize) + "x" +
+                                       std::to_string(maxPrintSize) + " are not printed"));
+        } else {
+            Game game(size, size, minesFor(size, size, 0.15625), seed, size / 2, size / 2);
+            game.play(size / 2, size / 2, 'R');
+            for (int c = 0; c < size; ++c)
+                game.play(c, 0, 'F');
+
+            NullBuffer discard;
+            std::streambuf *previous = std::cout.rdbuf(&discard);
+            results.push_back(measure("board_print", size, size, 0.15625, 1, [] {}, [&] { game.print(); }));
+            std::cout.rdbuf(previous);
+        }
+    }
+
+    // Move parsing does not depend on the board size beyond the bounds check
+    {
+        const Game game(1024, 1024, 1, seed);
+        constexpr std::array<std::string_view, 6> moves{"A1", "B3 F", "Z26 R", "AB120", "AMJ1024 F", "512,300 R"};
+        constexpr int calls = 600;
+        results.push_back(measure("parse_input", 1024, 1024, 0.0, calls, [] {}, [&] {
+            for (int i = 0; i < calls; ++i) {
+                const std::string_view input = moves[i % moves.size()];
+                if (game.isValidInput(input))
+                    sink = sink + game.parseInput(input).column;
+            }
+        }));
+    }
+
+    if (outPath.empty()) {
+        writeJson(std::cout, results);
+        return 0;
+    }
+
+    std::ofstream out(outPath);
+    writeJson(out, results);
+    return out ? 0 : 1;
+}
@@ -3,7 +3,13 @@
 
 #include <vector>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include "Cell.h"
+#include "MineLayer.h"
+#include "Random.h"
+#include "SaveFormat.h"
 
 /**
  * @brief Manages the minesweeper game board and its operations
@@ -19,23 +25,97 @@ private:
     int columns;                          ///< Number of columns in the board
     int rows;                             ///< Number of rows in the board
     int mines;                            ///< Total number of mines on the board
-    std::vector<std::vector<Cell>> board; ///< 2D grid of cells representing the board
+    std::vector<Cell> board;              ///< Row-major grid of packed cells (one allocation)
+    MineLayer mineLayer;                  ///< One bit per cell copy of the mine positions
+    int revealedSafeCells{0};             ///< Revealed cells that are not mines
+    int flaggedCells{0};                  ///< Cells currently carrying a flag
+    int hiddenCells{0};                   ///< Cells neither revealed nor flagged
+    std::uint64_t seed;                   ///< Seed the mine layout was generated from
+    SplitMix64 rng;                       ///< Engine used for mine placement
+    std::vector<std::uint8_t> numberScratch; ///< Row buffers of setNumber(), kept across resets
+    mutable int threeBV{-1};              ///< Cached getThreeBV(), -1 until first asked for this layout
+    mutable std::vector<std::uint64_t> threeBVMarks;    ///< Visited bits of getThreeBV(), kept across resets
+    mutable std::vector<std::uint32_t> threeBVPending;  ///< Flood-fill worklist of getThreeBV(), kept across resets
+    int safeColumn{-1};                   ///< Column of the mine-free first click, -1 if none
+    int safeRow{-1};                      ///< Row of the mine-free first click, -1 if none
+
+    // * Internals
+    void regenerate(std::uint64_t newSeed, std::span<const std::uint32_t> excluded);
 
 public:
     /**
      * @brief Constructs a new Board with specified dimensions and mine count
      *
      * Creates a board with the given dimensions, places mines randomly,
-     * and calculates the numbers for all non-mine cells.
+     * and calculates the numbers for all non-mine cells. The same seed
+     * always produces the same mine layout.
      *
      * @param columns Number of columns (width) of the board
      * @param rows Number of rows (height) of the board
      * @param mines Number of mines to place on the board
+     * @param seed Seed of the mine placement engine (random by default)
      *
      * @pre columns > 0 && rows > 0 && mines >= 0
      * @pre mines < (columns * rows) to ensure valid mine placement
      */
-    Board(int columns, int rows, int mines);
+    Board(int columns, int rows, int mines, std::uint64_t seed = randomSeed());
+
+    /**
+     * @brief Constructs a new Board whose first click is guaranteed to open
+     *
+     * Same as the main constructor, but the cell (safeColumn, safeRow) and its
+     * neighbours stay mine-free, so revealing it shows an empty cell. The
+     * mine count is clamped to what fits outside that zone.
+     *
+     * @param columns Number of columns (width) of the board
+     * @param rows Number of rows (height) of the board
+     * @param mines Number of mines to place on the board
+     * @param seed Seed of the mine placement engine
+     * @param safeColumn Column of the first click (0-based)
+     * @param safeRow Row of the first click (0-based)
+     *
+     * @pre isValidBoardCoordinate(safeColumn, safeRow)
+     */
+    Board(int columns, int rows, int mines, std::uint64_t seed, int safeColumn, int safeRow);
+
+    /**
+     * @brief Restores a board from a save (see SaveFormat.h)
+     *
+     * Cells and mine words are block-copied; counters come from the header.
+     *
+     * @param header Header of the save, already checked by Game::load()
+     * @param save Whole save, SaveFormat::fileSize(header) bytes
+     */
+    Board(const SaveFormat::Header &header, std::span<const std::uint8_t> save);
+
+    /**
+     * @brief Regenerates the board in place from a new seed
+     *
+     * Clears every cell and counter and places a new layout with the same
+     * dimensions and mine count. Storage is reused, so repeated resets do
+     * not allocate; the result equals a freshly constructed board.
+     *
+     * @param newSeed Seed of the new mine layout
+     */
+    void reset(std::uint64_t newSeed);
+
+    /**
+     * @brief Regenerates the board in place, keeping a first click and its neighbours mine-free
+     * @param newSeed Seed of the new mine layout
+     * @param safeColumn Column of the first click (0-based)
+     * @param safeRow Row of the first click (0-based)
+     */
+    void reset(std::uint64_t newSeed, int safeColumn, int safeRow);
+
+    /**
+     * @brief Replaces the mine layout with a given one (e.g. loaded from a replay)
+     *
+     * The mine count follows the layout; the seed is kept but no longer
+     * describes the board.
+     *
+     * @param layout Mine bits of a board with the same dimensions
+     */
+    void reset(const MineLayer &layout);
 
     // * Getters
 
@@ -51,6 +131,15 @@ public:
      */
     int getRows() const;
 
+    /**
+     * @brief Converts board coordinates into an offset of the row-major cell buffer
+     * @param column Column index (0-based)
+     * @param row Row index (0-based)
+     * @return std::size_t Offset of the cell inside getBoard()
+     * @pre isValidBoardCoordinate(column, row)
+     */
+    std::size_t index(int column, int row) const { return static_cast<std::size_t>(row) * columns + column; }
+
     /**
      * @brief Gets a read-only copy of the cell at specified coordinates
      * @param column Column index (0-based)
@@ -69,6 +158,13 @@ public:
      */
     Cell &getCell(int column, int row);
 
+    /**
+     * @brief Gets a mutable reference to the cell at a buffer offset
+     * @param index Offset into the row-major buffer, see index()
+     * @return Cell& Reference to the cell at that offset
+     */
+    Cell &getCell(std::size_t index) { return board[index]; }
+
     /**
      * @brief Gets the content type of the cell at specified coordinates
      * @param column Column index (0-based)
@@ -79,10 +175,10 @@ public:
     CellContent getCellContent(int column, int row) const;
 
     /**
-     * @brief Gets a copy of the entire board structure
-     * @return std::vector<std::vector<Cell>> 2D vector containing all board cells
+     * @brief Gets read-only access to the entire board structure
+     * @return const std::vector<Cell>& Row-major buffer of all cells, see index()
      */
-    std::vector<std::vector<Cell>> getBoard() const;
+    const std::vector<Cell> &getBoard() const;
 
     /**
      * @brief Gets the total number of mines on the board
@@ -90,6 +186,88 @@ public:
      */
     int getMines() const;
 
+    /**
+     * @brief Gets the number of non-mine cells (the cells to reveal to win)
+     * @return int Cells on the board minus mines
+     */
+    int getSafeCellCount() const { return columns * rows - mines; }
+
+    /**
+     * @brief Gets the number of revealed non-mine cells
+     * @return int Running count, updated by revealCell()
+     */
+    int getRevealedSafeCount() const { return revealedSafeCells; }
+
+    /**
+     * @brief Gets the number of flagged cells
+     * @return int Running count, updated by toggleFlag()
+     */
+    int getFlagCount() const { return flaggedCells; }
+
+    /**
+     * @brief Gets the number of cells that are neither revealed nor flagged
+     * @return int Running count, updated by revealCell() and toggleFlag()
+     */
+    int getHiddenCount() const { return hiddenCells; }
+
+    /**
+     * @brief Gets the number of revealed mines (non-zero only once a game is lost)
+     * @return int Derived from the running counters in O(1)
+     */
+    int getRevealedMineCount() const { return columns * rows - hiddenCells - flaggedCells - revealedSafeCells; }
+
+    /**
+     * @brief Packs the visible state of every cell, two bits per cell (0 hidden, 1 revealed, 2 flagged)
+     * @param packed Receives (cells + 3) / 4 bytes, cell i in bits 2 * (i % 4) of byte i / 4
+     *
+     * Together with the seed this captures a game position in a quarter of a
+     * byte per cell (used for Game's history snapshots).
+     */
+    void packVisibleState(std::vector<std::uint8_t> &packed) const;
+
+    /**
+     * @brief Writes the board part of a save
+     * @param header Receives dimensions, seed, safe click and counters
+     * @param save Destination of SaveFormat::fileSize(header) bytes, zero-filled; cells and mine words are copied in
+     */
+    void saveTo(SaveFormat::Header &header, std::span<std::uint8_t> save) const;
+
+    /**
+     * @brief Gets the 3BV of the layout: the fewest reveals that clear the board without chords
+     *
+     * Every opening (connected region of empty cells, with its bordering
+     * numbers) counts one click, and every number that borders no opening
+     * counts one click of its own. Computed with one flood fill over the
+     * layout on first use and cached until the next reset().
+     *
+     * @return int Bechtel's Board Benchmark Value (0 for an all-mine board)
+     */
+    int getThreeBV() const;
+
+    /**
+     * @brief Gets the seed the mine layout was generated from
+     * @return std::uint64_t Seed that regenerates this exact board
+     */
+    std::uint64_t getSeed() const;
+
+    /**
+     * @brief Gets the first click kept mine-free by the constructor or reset() (see the safe-zone overloads)
+     * @return int Column (0-based), or -1 if the layout has no safe zone
+     */
+    int getSafeColumn() const { return safeColumn; }
+
+    /**
+     * @brief Gets the row of the mine-free first click
+     * @return int Row (0-based), or -1 if the layout has no safe zone
+     */
+    int getSafeRow() const { return safeRow; }
+
+    /**
+     * @brief Gets the bit-plane holding the mine positions
+     * @return const MineLayer& One bit per cell, rows padded to 64-bit words
+     */
+    const MineLayer &getMineLayer() const;
+
     // * Setters
 
     /**
@@ -101,19 +279,74 @@ public:
      */
     void setCellContent(int column, int row, CellContent content);
 
+    /**
+     * @brief Reveals a hidden cell and updates the running counters
+     * @param index Offset into the row-major buffer, see index()
+     * @return bool True if the cell was hidden and is now revealed
+     *
+     * @note Game state changes must go through this method (and toggleFlag())
+     *       rather than Cell::setState(), otherwise the counters drift
+     */
+    bool revealCell(std::size_t index)
+    {
+        Cell &cell = board[index];
+        if (!cell.isHidden())
+            return false;
+
+        cell.setState(CellState::Revealed);
+        --hiddenCells;
+        if (!cell.isMine())
+            ++revealedSafeCells;
+        return true;
+    }
+
+    /**
+     * @brief Hides a revealed cell again and updates the running counters (undo of revealCell())
+     * @param index Offset into the row-major buffer, see index()
+     * @return bool True if the cell was revealed and is now hidden
+     */
+    bool hideCell(std::size_t index)
+    {
+        Cell &cell = board[index];
+        if (!cell.isRevealed())
+            return false;
+
+        cell.setState(CellState::Hidden);
+        ++hiddenCells;
+        if (!cell.isMine())
+            --revealedSafeCells;
+        return true;
+    }
+
+    /**
+     * @brief Toggles the flag of a cell that is not revealed and updates the counters
+     * @param index Offset into the row-major buffer, see index()
+     * @return bool True if the flag changed
+     */
+    bool toggleFlag(std::size_t index);
+
     /**
      * @brief Randomly places mines across the board
      *
      * Distributes the specified number of mines randomly across the board,
-     * ensuring no cell contains more than one mine.
+     * ensuring no cell contains more than one mine. Uses Floyd's sampling
+     * algorithm (MineLayer::scatter), which draws exactly `mines` random numbers
+     * and picks a uniformly random set of distinct cells in O(mines), whatever
+     * the density.
+     * Mines are recorded in the bit-plane; setNumber() transfers them to the
+     * cells, so only the compact layer sees random writes.
+     *
+     * @param excluded Sorted buffer offsets that must stay mine-free
      */
-    void setMines();
+    void setMines(std::span<const std::uint32_t> excluded = {});
 
     /**
      * @brief Calculates and sets numbers for all non-mine cells
      *
      * For each cell that doesn't contain a mine, calculates the number
      * of adjacent mines and sets the cell's content and nearby mine count.
+     * Counts are computed a row at a time from the mine bit-plane with
+     * MineLayer::countNeighbours, so no per-cell bounds checks are needed.
      */
     void setNumber();
 
@@ -140,19 +373,41 @@ public:
      * @brief Renders the board to the terminal with borders and labels
      *
      * Displays the current state of the board with:
-     * - Column labels (A, B, C, ...)
+     * - Column labels (A, B, C, ..., Z, AA, AB, ...)
      * - Row labels (1, 2, 3, ...)
      * - Bordered grid showing cell states
      * - Colored numbers for mine counts
+     *
+     * The frame is built by a BoardRenderer and written with one call;
+     * callers that redraw often should keep their own renderer (as Game
+     * does) so its buffer is reused.
      */
     void print() const;
 
     /**
      * @brief Generates random valid coordinates within the board
      * @return std::array<int, 2> Array containing [column, row] coordinates
+     * @note Draws from the board's seeded engine, so results are reproducible
+     */
+    std::array<int, 2> generateRandomCoordinates();
+
+    /**
+     * @brief Produces a fresh non-deterministic seed
+     * @return std::uint64_t Seed built from std::random_device
      * @note Uses std::random_device for true randomness!
      */
-    std::array<int, 2> generateRandomCoordinates() const;
+    static std::uint64_t randomSeed();
+
+    /**
+     * @brief Gets how many mines a board of this shape actually places
+     * @param columns Number of columns
+     * @param rows Number of rows
+     * @param mines Number of mines requested
+     * @param safeColumn Column of the safe first click, or -1 for none
+     * @param safeRow Row of the safe first click, or -1 for none
+     * @return int mines clamped to the cells, minus the safe zone around the first click if any
+     */
+    static int minesFitting(int columns, int rows, int mines, int safeColumn = -1, int safeRow = -1);
 };
 
 #endif // BOARD_H
\ No newline at end of file
@@ -0,0 +1,52 @@
+#ifndef BOARDLIMITS_H
+#define BOARDLIMITS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Runtime limits for the board dimensions accepted by the front ends
+ *
+ * The engine itself scales linearly with the number of cells; these limits
+ * only protect interactive entry points (native prompt, web page) from
+ * accidental huge boards. Both the native binary (`--max-size`) and the web
+ * bridge (`js_set_max_size`) can change them at runtime. Whatever the
+ * limits, a board never has more than MaxCells cells, so `columns * rows`
+ * (and every count derived from it) fits in an int.
+ */
+struct BoardLimits
+{
+    int minSize{5};     ///< Smallest accepted number of columns or rows
+    int maxSize{10000}; ///< Largest accepted number of columns or rows
+
+    static constexpr std::int64_t MaxCells = std::numeric_limits<int>::max(); ///< Largest accepted columns * rows
+
+    /**
+     * @brief Checks whether both dimensions (and their product) are inside the limits
+     * @param columns Requested number of columns
+     * @param rows Requested number of rows
+     * @return bool True if the board can be created as requested
+     */
+    bool accepts(int columns, int rows) const
+    {
+        return columns >= minSize && rows >= minSize && columns <= maxSize && rows <= maxSize &&
+               static_cast<std::int64_t>(columns) * rows <= MaxCells;
+    }
+
+    /**
+     * @brief Clamps both dimensions into the limits, giving up rows if the board would exceed MaxCells
+     * @param columns Requested number of columns, replaced by the closest accepted value
+     * @param rows Requested number of rows, replaced by the closest accepted value
+     */
+    void clamp(int &columns, int &rows) const
+    {
+        const auto largest = [this](std::int64_t cap) {
+            return static_cast<int>(std::max<std::int64_t>(minSize, std::min<std::int64_t>(maxSize, cap)));
+        };
+        columns = std::clamp(columns, minSize, largest(MaxCells / std::max(1, minSize)));
+        rows = std::clamp(rows, minSize, largest(MaxCells / std::max(1, columns)));
+    }
+};
+
+#endif // BOARDLIMITS_H
@@ -0,0 +1,75 @@
+#ifndef BOARDRENDERER_H
+#define BOARDRENDERER_H
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "Board.h"
+#include "ChunkedBoard.h"
+
+/**
+ * @brief Renders a Board into one reusable text buffer
+ *
+ * The whole frame (labels, borders, cells and colour codes) is appended to
+ * a single std::string whose capacity is kept between frames, using the
+ * constexpr ANSI table from Color.h, and is then handed to the stream in
+ * one write. Output is identical, byte for byte, to what Board::print
+ * always produced.
+ */
+class BoardRenderer
+{
+private:
+    // * Properties
+    std::string frame; ///< Last rendered frame; its capacity is reused
+
+    // * Internals
+    template <typename CellAt>
+    std::string_view renderGrid(int columns, int rows, CellAt cellAt);
+
+public:
+    /**
+     * @brief Gets the width of the row labels of a board
+     * @param rows Number of rows of the board
+     * @return int Digits of the largest row number, at least 2
+     *
+     * Cell (column, row) starts at screen column labelWidth + 5 + 3 * column
+     * and screen line row + 3 (both 1-based) of a rendered frame.
+     */
+    static int labelWidth(int rows);
+
+    /**
+     * @brief Appends the three-character glyph of one cell
+     * @param frame Destination text
+     * @param cell Cell to draw
+     */
+    static void appendCell(std::string &frame, Cell cell);
+
+    /**
+     * @brief Builds the frame of a board
+     * @param board Board to render
+     * @return std::string_view The frame, valid until the next render()
+     */
+    std::string_view render(const Board &board);
+
+    /**
+     * @brief Builds the frame of a window onto an infinite world, labelled from A1 at its corner
+     * @param world World to render (chunks in view are generated)
+     * @param left World column of the window's first column
+     * @param top World row of the window's first row
+     * @param columns Columns in the window
+     * @param rows Rows in the window
+     * @return std::string_view The frame, valid until the next render()
+     */
+    std::string_view render(ChunkedBoard &world, std::int64_t left, std::int64_t top, int columns, int rows);
+
+    /**
+     * @brief Renders a board and writes the frame with a single call
+     * @param board Board to render
+     * @param out Destination stream (flushed afterwards)
+     */
+    void draw(const Board &board, std::ostream &out = std::cout);
+};
+
+#endif // BOARDRENDERER_H
@@ -0,0 +1,65 @@
+#ifndef BOT_H
+#define BOT_H
+
+#include <cstdint>
+
+#include "Game.h"
+#include "ProbabilityEngine.h"
+#include "Random.h"
+#include "Solver.h"
+
+/**
+ * @brief Automatic player used for simulations and benchmarks
+ *
+ * A bot is bound to one Game and keeps its Solver and ProbabilityEngine
+ * between games: after Game::reset() the bot only needs reset() too, so
+ * playing many games on one board allocates nothing per game.
+ */
+class Bot
+{
+public:
+    /**
+     * @brief How the bot picks its moves
+     */
+    enum class Strategy : std::uint8_t
+    {
+        Random,     ///< Reveals uniformly random hidden cells
+        Solver,     ///< Reveals proven safe cells, guesses at random when stuck
+        Probability ///< Reveals proven safe cells, guesses the least likely mine when stuck
+    };
+
+private:
+    // * Properties
+    Game &game;               ///< Game being played
+    Strategy strategy;        ///< Move selection
+    Solver solver;            ///< Deductions (unused by Random)
+    ProbabilityEngine engine; ///< Guesses (used by Probability only)
+    SplitMix64 rng;           ///< Random guesses, reseeded from the board seed
+
+    // * Internals
+    bool randomHiddenCell(int &column, int &row);
+    bool nextMove(int &column, int &row);
+
+public:
+    /**
+     * @brief Constructs a bot bound to a game
+     * @param game Game to play; must outlive the bot and keep its dimensions
+     * @param strategy Move selection
+     */
+    Bot(Game &game, Strategy strategy);
+
+    /**
+     * @brief Prepares for a new game after Game::reset()
+     */
+    void reset();
+
+    /**
+     * @brief Plays the current game until it is won or lost
+     * @param startColumn Column of the first click (0-based)
+     * @param startRow Row of the first click (0-based)
+     * @return int Number of moves played, including the first click
+     */
+    int playToEnd(int startColumn, int startRow);
+};
+
+#endif // BOT_H
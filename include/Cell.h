@@ -5,6 +5,8 @@
 #ifndef CELL_H
 #define CELL_H
 
+#include <cstdint>
+
 #include "enums/CellContent.h"
 #include "enums/CellState.h"
 
@@ -14,14 +16,28 @@
  * The Cell class encapsulates the state and content of an individual cell
  * in the minesweeper game. Each cell has content (empty, number, or mine),
  * a visual state (hidden, revealed, or flagged), and tracks nearby mine count.
+ *
+ * All three fields are packed into a single byte so a Board can keep its
+ * cells in one contiguous buffer:
+ * - bits 0-3: nearby mine count (0-8)
+ * - bits 4-5: state (0 = hidden, 1 = revealed, 2 = flagged)
+ * - bits 6-7: content (0 = empty, 1 = number, 2 = mine)
  */
 class Cell
 {
 private:
+    // * Bit layout
+    static constexpr std::uint8_t CountMask = 0x0F;
+    static constexpr std::uint8_t StateShift = 4;
+    static constexpr std::uint8_t StateMask = 0x30;
+    static constexpr std::uint8_t ContentShift = 6;
+    static constexpr std::uint8_t ContentMask = 0xC0;
+
     // * Properties
-    CellContent content; ///< What the cell contains (empty, number, or mine)
-    CellState state;     ///< Current visual state (hidden, revealed, or flagged)
-    int nearbyMines{0};  ///< Number of mines in adjacent cells (0-8)
+    std::uint8_t bits{0}; ///< Packed count, state and content (see class description)
+
+    static std::uint8_t encodeContent(CellContent content);
+    static std::uint8_t encodeState(CellState state);
 
 public:
     /**
@@ -125,4 +141,6 @@ public:
     void toggleFlag();
 };
 
+static_assert(sizeof(Cell) == 1, "Cell must stay packed into a single byte");
+
 #endif // CELL_H
\ No newline at end of file
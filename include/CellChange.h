@@ -0,0 +1,24 @@
+#ifndef CELLCHANGE_H
+#define CELLCHANGE_H
+
+#include <cstdint>
+
+#include "enums/ChangeReason.h"
+
+/**
+ * @brief One cell whose visible state changed during a move
+ *
+ * Game records these in order while it plays (see Game::getChanges), so a
+ * front end can redraw exactly the cells a move touched. The layout is
+ * fixed at 8 bytes so the list can be read from JavaScript over the WASM
+ * heap: a uint32 offset followed by a one-byte reason.
+ */
+struct CellChange
+{
+    std::uint32_t index;  ///< Offset of the cell in the board buffer (see Board::index)
+    ChangeReason reason;  ///< What happened to it
+};
+
+static_assert(sizeof(CellChange) == 8, "CellChange is read from JS as 8-byte records");
+
+#endif // CELLCHANGE_H
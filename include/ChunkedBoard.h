@@ -0,0 +1,170 @@
+#ifndef CHUNKEDBOARD_H
+#define CHUNKEDBOARD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Cell.h"
+#include "MineLayer.h"
+
+/**
+ * @brief Unbounded minesweeper world generated lazily in fixed-size chunks
+ *
+ * The world is split into ChunkSize x ChunkSize chunks. A chunk's mines are
+ * derived on first access from a hash of (seed, chunk coordinates), so any
+ * chunk can be generated independently and always looks the same. Numbers
+ * are computed per chunk with the same MineLayer kernel Board::setNumber
+ * uses; cells on a chunk edge get their missing neighbours by generating the
+ * mines (only) of the adjacent chunks on demand.
+ *
+ * Memory and time are proportional to the area the player has explored, so
+ * creating a board is O(1) regardless of how far the player wanders.
+ *
+ * Revealing a mine loses the world: no more cells can be revealed. There is
+ * no win, since the world never runs out of safe cells; the revealed count is
+ * the player's score. The terminal plays it with `--infinite`.
+ */
+class ChunkedBoard
+{
+public:
+    static constexpr int ChunkSize = 64; ///< Cells per chunk side (one 64-bit mine word per chunk row)
+
+private:
+    /**
+     * @brief One generated chunk: mines always, cells once numbers were needed
+     */
+    struct Chunk
+    {
+        MineLayer mines{ChunkSize, ChunkSize}; ///< Mine bits of the chunk
+        std::vector<Cell> cells;               ///< Row-major cells, empty until numbered
+    };
+
+    // * Properties
+    int minesPerChunk;                                          ///< Exact number of mines in every chunk
+    std::uint64_t seed;                                         ///< World seed
+    std::unordered_map<std::uint64_t, std::unique_ptr<Chunk>> chunks; ///< Generated chunks by packed key
+    std::vector<std::int64_t> revealQueue;                      ///< Pending empty cells (column, row pairs)
+    std::int64_t revealedCells{0};                              ///< Revealed cells across the world
+    std::int64_t flaggedCells{0};                               ///< Flags across the world
+    bool lost{false};                                           ///< A mine was revealed
+    std::uint64_t cachedKey{0};                                 ///< Key of the last numbered chunk looked up
+    Chunk *cachedChunk{nullptr};                                ///< Last numbered chunk looked up (flood fills stay local)
+
+    // * Chunk management
+    static std::int64_t chunkOf(std::int64_t coordinate) { return coordinate >> 6; }
+    static std::uint64_t keyOf(std::int64_t chunkColumn, std::int64_t chunkRow);
+    Chunk &mineChunk(std::int64_t chunkColumn, std::int64_t chunkRow);
+    Chunk &numberedChunk(std::int64_t chunkColumn, std::int64_t chunkRow);
+    void setNumber(std::int64_t chunkColumn, std::int64_t chunkRow, Chunk &chunk);
+    Cell &cellAt(std::int64_t column, std::int64_t row);
+
+public:
+    /**
+     * @brief Constructs an empty world; no chunk is generated yet
+     * @param minesPerChunk Mines in each chunk (density = minesPerChunk / ChunkSize^2)
+     * @param seed World seed; equal seeds give equal worlds
+     * @pre 0 <= minesPerChunk <= ChunkSize * ChunkSize
+     */
+    ChunkedBoard(int minesPerChunk, std::uint64_t seed);
+
+    // * Getters
+
+    /**
+     * @brief Gets the cell at world coordinates, generating its chunk if needed
+     * @param column World column (any 64-bit value within +-2^37)
+     * @param row World row (any 64-bit value within +-2^37)
+     * @return Cell Copy of the cell
+     */
+    Cell getCell(std::int64_t column, std::int64_t row);
+
+    /**
+     * @brief Checks whether a cell holds a mine (generates mines only, not numbers)
+     * @param column World column
+     * @param row World row
+     * @return bool True if the cell holds a mine
+     */
+    bool isMine(std::int64_t column, std::int64_t row);
+
+    /**
+     * @brief Gets the number of chunks generated so far (including mine-only chunks)
+     * @return std::size_t Generated chunk count
+     */
+    std::size_t getChunkCount() const { return chunks.size(); }
+
+    /**
+     * @brief Gets the number of revealed cells across the world
+     * @return std::int64_t Running count
+     */
+    std::int64_t getRevealedCount() const { return revealedCells; }
+
+    /**
+     * @brief Gets the number of flags across the world
+     * @return std::int64_t Running count
+     */
+    std::int64_t getFlagCount() const { return flaggedCells; }
+
+    /**
+     * @brief Gets the world seed
+     * @return std::uint64_t Seed passed to the constructor
+     */
+    std::uint64_t getSeed() const { return seed; }
+
+    /**
+     * @brief Checks whether a mine was revealed (reveals are then refused)
+     * @return bool True once the world is lost
+     */
+    bool isLost() const { return lost; }
+
+    /**
+     * @brief Checks whether the last reveal stopped at its limit with empty cells left to expand
+     * @return bool True if resumeReveal() has work to do
+     */
+    bool hasPendingReveal() const { return !revealQueue.empty(); }
+
+    // * Interaction
+
+    /**
+     * @brief Reveals a cell and flood-fills empty regions across chunks
+     *
+     * At low densities an empty region can be arbitrarily large, so the fill
+     * stops once `limit` cells are revealed (finishing the neighbours of the
+     * cell being expanded, so up to 8 more); the rest of the frontier is kept
+     * and continued by resumeReveal(). Revealing a mine loses the world (see
+     * isLost()).
+     *
+     * @param column World column
+     * @param row World row
+     * @param limit Maximum number of cells to reveal in this call
+     * @return int Number of cells revealed (0 if the cell was not hidden or the world is lost)
+     */
+    int reveal(std::int64_t column, std::int64_t row, int limit = 1 << 20);
+
+    /**
+     * @brief Reveals the hidden neighbours of a revealed number once as many of them are flagged
+     * @param column World column
+     * @param row World row
+     * @param limit Maximum number of cells to reveal in this call
+     * @return int Number of cells revealed (a wrong flag makes it reveal a mine and lose)
+     */
+    int chord(std::int64_t column, std::int64_t row, int limit = 1 << 20);
+
+    /**
+     * @brief Continues a flood fill that stopped at its limit
+     * @param limit Maximum number of cells to reveal in this call
+     * @return int Number of cells revealed
+     */
+    int resumeReveal(int limit = 1 << 20);
+
+    /**
+     * @brief Toggles the flag of a cell that is not revealed
+     * @param column World column
+     * @param row World row
+     * @return bool True if the flag changed
+     */
+    bool toggleFlag(std::int64_t column, std::int64_t row);
+};
+
+#endif // CHUNKEDBOARD_H
@@ -0,0 +1,68 @@
+#ifndef COORDINATES_H
+#define COORDINATES_H
+
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Conversions between column indices and spreadsheet-style labels
+ *
+ * Columns are labelled A..Z, then AA, AB, ... AZ, BA, ... (bijective base 26),
+ * so any board width gets unique, compact labels.
+ */
+namespace Coordinates
+{
+    /**
+     * @brief Appends the label of a column (0 -> "A", 25 -> "Z", 26 -> "AA")
+     * @param out String the label is appended to
+     * @param column Column index (0-based)
+     */
+    inline void appendColumnLabel(std::string &out, int column)
+    {
+        char letters[8];
+        int length = 0;
+
+        for (int value = column + 1; value > 0; value = (value - 1) / 26)
+            letters[length++] = static_cast<char>('A' + (value - 1) % 26);
+
+        while (length > 0)
+            out += letters[--length];
+    }
+
+    /**
+     * @brief Builds the label of a column
+     * @param column Column index (0-based)
+     * @return std::string Spreadsheet-style label
+     */
+    inline std::string columnLabel(int column)
+    {
+        std::string label;
+        appendColumnLabel(label, column);
+        return label;
+    }
+
+    /**
+     * @brief Parses a spreadsheet-style label back into a column index
+     * @param letters Upper- or lower-case letters only
+     * @return int Column index (0-based), or -1 if empty, invalid or too large
+     */
+    inline int parseColumnLabel(std::string_view letters)
+    {
+        if (letters.empty() || letters.size() > 6)
+            return -1;
+
+        int value = 0;
+        for (char ch : letters)
+        {
+            if (ch >= 'a' && ch <= 'z')
+                ch = static_cast<char>(ch - 'a' + 'A');
+            if (ch < 'A' || ch > 'Z')
+                return -1;
+            value = value * 26 + (ch - 'A' + 1);
+        }
+
+        return value - 1;
+    }
+}
+
+#endif // COORDINATES_H
@@ -4,12 +4,26 @@
 
 #ifndef GAME_H
 #define GAME_H
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <string_view>
+#include <vector>
 
 #include "Board.h"
+#include "BoardRenderer.h"
+#include "CellChange.h"
+#include "GameStatus.h"
+#include "MoveJournal.h"
+#include "SaveFormat.h"
 #include "enums/GameState.h"
+#include "enums/MoveOutcome.h"
 #include "InputData.h"
 
+class MineLayer;
+class ReplayWriter;
+
 /**
  * @brief Main game controller for the minesweeper application
  *
@@ -23,6 +37,25 @@ private:
     // * Properties
     Board board;                          ///< The game board containing all cells
     GameState state = GameState::Playing; ///< Current state of the game
+    std::vector<std::uint32_t> revealQueue; ///< Worklist of empty cells, reused by every reveal
+    std::vector<CellChange> changes;      ///< Cells changed by the last play(), playLine() or playBatch()
+    mutable BoardRenderer renderer;       ///< Frame buffer reused by every print()
+    int moves{0};                         ///< Moves passed to play() since the game started
+    std::chrono::steady_clock::time_point startTime{}; ///< First move, epoch until then
+    std::chrono::steady_clock::time_point endTime{};   ///< When the game was won or lost, epoch while playing
+    MoveJournal journal;                  ///< Undo / redo history (see enableHistory())
+    bool historyEnabled{false};           ///< Moves are journaled only when asked for
+    ReplayWriter *recorder{nullptr};      ///< Receives every applied move, if set (see setRecorder())
+
+    // * Internals
+    void applyMove(int column, int row, char action);
+    void dispatchMove(int column, int row, char action);
+    void stepBack();
+    void stepForward();
+    void setCellCode(std::size_t index, int code);
+    void syncState();
+
+    Game(const SaveFormat::Header &header, std::span<const std::uint8_t> save);
 
 public:
     /**
@@ -31,11 +64,69 @@ public:
      * @param columns Number of columns for the game board
      * @param rows Number of rows for the game board
      * @param mines Number of mines to place on the board
+     * @param seed Seed of the mine layout; reuse it to replay the same board
      *
      * @pre columns > 0 && rows > 0 && mines >= 0
      * @pre mines < (columns * rows) to ensure valid mine placement
      */
-    Game(int columns, int rows, int mines);
+    Game(int columns, int rows, int mines, std::uint64_t seed = Board::randomSeed());
+
+    /**
+     * @brief Constructs a new Game whose first click opens an empty area
+     *
+     * @param columns Number of columns for the game board
+     * @param rows Number of rows for the game board
+     * @param mines Number of mines to place on the board
+     * @param seed Seed of the mine layout
+     * @param startColumn Column of the first click (0-based); it and its neighbours hold no mine
+     * @param startRow Row of the first click (0-based)
+     */
+    Game(int columns, int rows, int mines, std::uint64_t seed, int startColumn, int startRow);
+
+    /**
+     * @brief Starts a new game on the same board dimensions without allocating
+     * @param seed Seed of the new mine layout
+     */
+    void reset(std::uint64_t seed);
+
+    /**
+     * @brief Starts a new game whose first click opens an empty area, without allocating
+     * @param seed Seed of the new mine layout
+     * @param startColumn Column of the first click (0-based)
+     * @param startRow Row of the first click (0-based)
+     */
+    void reset(std::uint64_t seed, int startColumn, int startRow);
+
+    /**
+     * @brief Starts a new game on a given mine layout (e.g. one stored in a replay)
+     * @param layout Mine bits of a board with the same dimensions
+     */
+    void reset(const MineLayer &layout);
+
+    // * Persistence
+
+    /**
+     * @brief Serialises the game into the save format (see SaveFormat.h)
+     *
+     * The whole save is built in one buffer of its final size, so writing it
+     * out is a single write call.
+     *
+     * @return std::vector<std::uint8_t> Header, cells and mine words; the history is not included
+     */
+    std::vector<std::uint8_t> save() const;
+
+    /**
+     * @brief Resumes a saved game
+     *
+     * The header is checked (magic, version, sizes, counters); cells and
+     * mine words are then block-copied, so loading a mapped file of any size
+     * does no per-cell work. The clock resumes from the saved time.
+     *
+     * @param save Bytes produced by save(), e.g. a MappedFile
+     * @return Game The saved game, history enabled (and empty) if it was on
+     * @throws std::runtime_error If the data is not a valid save
+     */
+    static Game load(std::span<const std::uint8_t> save);
 
     // * Getters
 
@@ -64,6 +155,7 @@ public:
      *
      * Called when all non-mine cells have been revealed.
      * This will cause the game loop to terminate with a victory message.
+     * Stops the clock.
      */
     void setWon();
 
@@ -72,6 +164,7 @@ public:
      *
      * Called when the player reveals a cell containing a mine.
      * This will cause the game loop to terminate with a defeat message.
+     * Stops the clock.
      */
     void setLost();
 
@@ -87,9 +180,16 @@ public:
      * - Checks win/lose conditions
      * - Continues until game ends
      *
+     * Natively the board lives on the terminal's alternate screen and each
+     * move redraws only the cells it changed (see TerminalScreen); the final
+     * board is printed on the normal screen when the game ends.
+     *
+     * @param keepOnExit End of input stops the loop without losing the game
+     *        (so it can be saved and resumed); by default it counts as a loss
+     *
      * @note This method blocks until the game is completed
      */
-    void start();
+    void start(bool keepOnExit = false);
 
     /**
      * @brief Displays input prompt and gets user move
@@ -104,45 +204,148 @@ public:
     static std::string prompt();
 
     /**
-     * @brief Validates if the input string matches the expected format
+     * @brief Validates a line of one or more moves
      *
-     * @param input The input string to validate
-     * @return bool True if the input matches the regex pattern for valid moves
+     * @param input The input line to validate
+     * @return bool True if the line holds at least one move and every move is inside the board
      *
-     * Expected format: [A-Z][1-26]( [FR])?
-     * - Column: Single letter A-Z
-     * - Row: Number 1-26
-     * - Action: Optional F (flag) or R (reveal)
+     * Moves are separated by spaces (see MoveParser for the grammar):
+     * - Column: Spreadsheet-style letters (A..Z, AA, AB, ...) or a 1-based number ("3,7")
+     * - Row: 1-based number, up to the board height
+     * - Action: Optional F (flag), R (reveal) or C (chord), attached or after a space
      */
-    bool isValidInput(const std::string &input) const;
+    bool isValidInput(std::string_view input) const;
 
     /**
-     * @brief Parses a valid input string into structured data
+     * @brief Parses the first move of a valid input line into structured data
      *
-     * @param input The validated input string to parse
+     * @param input The validated input line to parse
      * @return InputData Structure containing column, row, and action
      *
      * @pre input must be validated with isValidInput() first
      * @note If no action is specified, defaults to 'R' (reveal)
      */
-    InputData parseInput(const std::string &input) const;
+    InputData parseInput(std::string_view input) const;
+
+    /**
+     * @brief Validates and plays every move of an input line
+     *
+     * Stops early once the game is won or lost.
+     *
+     * @param input Line of moves, e.g. "A1 B2F C3"
+     * @return bool False (and nothing is played) if the line is not valid
+     */
+    bool playLine(std::string_view input);
 
     /**
      * @brief Processes a player's move on the board
      *
      * @param column Column index (0-based) where the move is made
      * @param row Row index (0-based) where the move is made
-     * @param action Action to perform ('R' for reveal, 'F' for flag)
+     * @param action Action to perform ('R' for reveal, 'F' for flag, 'C' for chord)
      *
      * Handles:
      * - Flag toggling for 'F' action
      * - Cell revelation and mine checking for 'R' action
+     * - Revealing around a satisfied number for 'C' action (see chord())
      * - Automatic propagation for empty cells
      *
      * @pre Board coordinates must be valid
      */
     void play(int column, int row, char action);
 
+    /**
+     * @brief Plays a sequence of moves in one call
+     *
+     * Moves are applied in order until the game ends; a loss stops the
+     * batch at the move that exploded. The win condition is the O(1)
+     * counter check, so it is tested after every move and a won game is
+     * never played on. No per-move parsing, validation text or printing
+     * is involved, which makes this the entry point for replays and bots.
+     *
+     * @param moves Moves (0-based column, row, action 'R', 'F' or 'C')
+     * @param outcomes Receives one MoveOutcome per move (Skipped after the end);
+     *        may be shorter than moves, extra results are dropped
+     * @return std::size_t Number of moves played
+     */
+    std::size_t playBatch(std::span<const InputData> moves, std::span<MoveOutcome> outcomes);
+
+    // * History
+
+    /**
+     * @brief Turns the undo / redo journal on or off and clears it
+     *
+     * Off by default, so bots and simulations pay nothing for it. While on,
+     * every move that changes a cell is journaled with its changes.
+     *
+     * @param enabled True to record moves
+     */
+    void enableHistory(bool enabled = true);
+
+    /**
+     * @brief Takes back the last applied move
+     *
+     * Walks the move's change records backwards, so the cost is O(cells it
+     * changed). A lost game becomes playable again when the explosion is
+     * undone. getChanges() then lists the cells that changed back.
+     *
+     * @return bool False if there is nothing to undo
+     */
+    bool undo();
+
+    /**
+     * @brief Re-applies the last undone move from its records, in O(cells it changed)
+     * @return bool False if there is nothing to redo
+     */
+    bool redo();
+
+    /**
+     * @brief Jumps to any point of the history
+     *
+     * Steps through the journal, or restores the nearest earlier snapshot
+     * and redoes from there when that walks fewer records. getChanges()
+     * lists the cells that changed on the way (a cell may appear twice).
+     *
+     * @param position Number of moves to keep applied (clamped to the history length)
+     */
+    void rewindTo(std::size_t position);
+
+    /**
+     * @brief Gets the journal (positions, entries and snapshots)
+     * @return const MoveJournal& History of the game
+     */
+    const MoveJournal &getHistory() const { return journal; }
+
+    /**
+     * @brief Checks whether moves are being journaled
+     * @return bool True after enableHistory()
+     */
+    bool isHistoryEnabled() const { return historyEnabled; }
+
+    /**
+     * @brief Streams every applied move to a replay
+     *
+     * Moves from play(), playLine() and playBatch() are appended as they are
+     * applied; undo() and redo() append an undo / redo record, and
+     * rewindTo() one per step. Invalid batch moves are not recorded.
+     *
+     * @param writer Writer whose header was made from this game, or nullptr to stop; must outlive the game or be unset
+     */
+    void setRecorder(ReplayWriter *writer) { recorder = writer; }
+
+    /**
+     * @brief Reveals the unflagged neighbours of a number whose mines are all flagged
+     *
+     * Does nothing unless the cell is a revealed number with exactly that
+     * many flagged neighbours. A wrong flag makes the chord reveal a mine,
+     * which loses the game.
+     *
+     * @param column Column index (0-based) of the number
+     * @param row Row index (0-based) of the number
+     * @return int Number of cells revealed
+     */
+    int chord(int column, int row);
+
     /**
      * @brief Reveals a cell and propagates to adjacent empty cells
      *
@@ -150,21 +353,27 @@ public:
      * @param row Row index (0-based) of the cell to reveal
      *
      * If the revealed cell is empty (no nearby mines), automatically
-     * reveals all adjacent cells recursively until non-empty cells
-     * are reached. This implements the classic minesweeper flood-fill!
+     * reveals all adjacent cells until non-empty cells are reached.
+     * This implements the classic minesweeper flood-fill!
+     *
+     * The fill is iterative: cells are marked revealed as soon as they are
+     * discovered, and only empty cells are pushed on a worklist that is kept
+     * between moves. Every cell is touched at most once, so the cost is
+     * linear in the revealed area and stack depth does not depend on it.
+     *
+     * @return int Number of cells revealed by this call (0 if none)
      *
      * @note Respects flagged cells (won't reveal them)
-     * @pre Board coordinates must be valid
      */
-    void revealCellAndPropagate(int column, int row);
+    int revealCellAndPropagate(int column, int row);
 
     // * Utils
 
     /**
      * @brief Displays the current board state to the terminal
      *
-     * Delegates to the Board's print method to render the current
-     * state of all cells with proper formatting and colors.
+     * Renders the current state of all cells with proper formatting and
+     * colors, reusing the game's frame buffer, and writes it in one call.
      */
     void print() const;
 
@@ -174,29 +383,64 @@ public:
      * Uses platform-specific commands:
      * - Windows: "cls"
      * - Unix/Linux/macOS: "clear"
+     * - Web: empties the output element
      *
-     * @note Static method as it doesn't depend on game state
+     * @note Static method as it doesn't depend on game state; the native game
+     *       loop no longer uses it (TerminalScreen redraws in place)
      */
     static void clear();
 
     /**
      * @brief Checks if the player has won and updates game state
      *
-     * Counts revealed non-mine cells and compares with the total
-     * number of non-mine cells on the board. If all non-mine cells
-     * are revealed, sets the game state to Won.
+     * Compares the board's running count of revealed non-mine cells with
+     * the total number of non-mine cells on the board. If all non-mine
+     * cells are revealed, sets the game state to Won.
      *
-     * @note Called after each successful move to detect victory
+     * @note Called after each successful move to detect victory; O(1)
      */
     void checkWinCondition();
 
+    /**
+     * @brief Gets the number of moves played (reveals, flags and chords)
+     * @return int Moves since the game started
+     */
+    int getMoveCount() const { return moves; }
+
+    /**
+     * @brief Gets the time played, from the first move until the game ended (or now)
+     * @return std::int64_t Milliseconds; 0 before the first move
+     */
+    std::int64_t getElapsedMilliseconds() const;
+
+    /**
+     * @brief Gathers counters, state, moves, time and 3BV in one struct
+     * @return GameStatus Current status; O(1) after the first call per layout
+     */
+    GameStatus getStatus() const;
+
     // Exposed getters (used by web UI)
     int getColumns() const { return board.getColumns(); }
     int getRows() const { return board.getRows(); }
     int getMinesTotal() const { return board.getMines(); }
     int getFlagsCount() const;
     int getRevealedCount() const;
+    int getHiddenCount() const { return board.getHiddenCount(); }
     int getStateValue() const { return static_cast<int>(state); }
+    const Board &getBoard() const { return board; }
+
+    /**
+     * @brief Gets the cells whose visible state changed, with the reason, in the order they changed
+     *
+     * The list restarts with every play(), playLine(), playBatch(), undo(),
+     * redo() and rewindTo() call (a line or batch collects all its moves),
+     * so after a move it holds exactly what a front end has to redraw. Direct calls to chord() and
+     * revealCellAndPropagate() append to it.
+     *
+     * @return const std::vector<CellChange>& Changes, storage reused between moves
+     */
+    const std::vector<CellChange> &getChanges() const { return changes; }
+    std::uint64_t getSeed() const { return board.getSeed(); }
 };
 
 #endif // GAME_H
\ No newline at end of file
@@ -0,0 +1,131 @@
+#ifndef GAMEPOOL_H
+#define GAMEPOOL_H
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Game.h"
+
+/**
+ * @brief Recycles finished games so new ones of the same shape reuse their storage
+ *
+ * A Game owns a few buffers proportional to its board (cells, mine bits,
+ * number and 3BV scratch, worklists, history). Instead of freeing them
+ * when a game ends, release() keeps the Game in a bucket keyed by its
+ * columns, rows and mine count (the mines actually placed, see
+ * Board::minesFitting()); the next acquire() of that shape regenerates
+ * it in place with Game::reset(), which allocates nothing once the buffers
+ * have reached their working size. Steady churn of same-shaped games
+ * (server sessions, web restarts) therefore stops touching the heap.
+ *
+ * Idle games are capped by their total cell count; beyond it released games
+ * are freed. Games are handed out as Lease, a unique_ptr whose deleter
+ * returns them; the pool must outlive its leases. All members are
+ * thread-safe.
+ */
+class GamePool
+{
+public:
+    /**
+     * @brief Counters since construction
+     */
+    struct Stats
+    {
+        std::uint64_t created{0};   ///< Games constructed (each one allocates its buffers)
+        std::uint64_t reused{0};    ///< acquire() calls served by resetting an idle game
+        std::uint64_t released{0};  ///< Games returned and kept for reuse
+        std::uint64_t discarded{0}; ///< Games returned but freed (over the idle cap)
+        std::size_t idleGames{0};   ///< Games waiting for reuse
+        std::size_t idleCells{0};   ///< Cells of those games
+    };
+
+    /**
+     * @brief Deleter of a Lease: hands the game back to its pool (or deletes it without one)
+     */
+    struct Releaser
+    {
+        GamePool *pool{nullptr};
+        void operator()(Game *game) const;
+    };
+
+    using Lease = std::unique_ptr<Game, Releaser>;
+
+private:
+    /**
+     * @brief Bucket key: games are interchangeable when these match
+     */
+    struct Shape
+    {
+        int columns;
+        int rows;
+        int mines;
+        auto operator<=>(const Shape &) const = default;
+    };
+
+    // * Properties
+    mutable std::mutex lock;                                     ///< Guards everything below
+    std::map<Shape, std::vector<std::unique_ptr<Game>>> idle;    ///< Released games by shape
+    std::size_t maxIdleCells;                                    ///< Cap on Stats::idleCells
+    Stats stats;                                                 ///< Counters
+
+    // * Internals
+    std::unique_ptr<Game> take(const Shape &shape);
+    void release(Game *game);
+
+public:
+    /**
+     * @brief Constructs an empty pool
+     * @param maxIdleCells Largest total number of cells kept in idle games (64M by default, about 80 MB)
+     */
+    explicit GamePool(std::size_t maxIdleCells = std::size_t{1} << 26);
+
+    GamePool(const GamePool &) = delete;
+    GamePool &operator=(const GamePool &) = delete;
+
+    /**
+     * @brief Gets a game on a fresh board, reusing an idle one of the same shape if possible
+     * @param columns Number of columns
+     * @param rows Number of rows
+     * @param mines Number of mines
+     * @param seed Seed of the mine layout
+     * @return Lease Game ready to play, history off and no recorder
+     */
+    Lease acquire(int columns, int rows, int mines, std::uint64_t seed);
+
+    /**
+     * @brief Gets a game whose first click at (startColumn, startRow) opens an empty area
+     * @param columns Number of columns
+     * @param rows Number of rows
+     * @param mines Number of mines
+     * @param seed Seed of the mine layout
+     * @param startColumn Column of the first click (0-based)
+     * @param startRow Row of the first click (0-based)
+     * @return Lease Game ready to play, history off and no recorder
+     */
+    Lease acquire(int columns, int rows, int mines, std::uint64_t seed, int startColumn, int startRow);
+
+    /**
+     * @brief Takes over a game built elsewhere (e.g. Game::load()), so its storage is recycled later
+     * @param game Game to manage
+     * @return Lease Lease returning it to this pool
+     */
+    Lease adopt(Game &&game);
+
+    /**
+     * @brief Frees every idle game
+     */
+    void trim();
+
+    /**
+     * @brief Gets the counters
+     * @return Stats Snapshot of the counters
+     */
+    Stats getStats() const;
+};
+
+#endif // GAMEPOOL_H
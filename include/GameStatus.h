@@ -0,0 +1,29 @@
+#ifndef GAMESTATUS_H
+#define GAMESTATUS_H
+
+#include <cstdint>
+
+/**
+ * @brief Snapshot of everything the front ends show about a game
+ *
+ * Filled by Game::getStatus() in O(1) (3BV is computed once per layout).
+ * Every field is a 32-bit integer in a fixed order so the web page can read
+ * the whole struct with one Int32Array over the WASM heap (see js_status).
+ */
+struct GameStatus
+{
+    std::int32_t columns{0};      ///< Board width
+    std::int32_t rows{0};         ///< Board height
+    std::int32_t mines{0};        ///< Mines on the board
+    std::int32_t flags{0};        ///< Flags currently placed
+    std::int32_t revealed{0};     ///< Revealed non-mine cells
+    std::int32_t state{-1};       ///< GameState value (0 = Playing, 1 = Won, 2 = Lost), -1 = no game
+    std::int32_t moves{0};        ///< Moves played (reveals, flags and chords)
+    std::int32_t elapsedMs{0};    ///< Milliseconds since the first move, frozen when the game ends
+    std::int32_t lastRevealed{0}; ///< Cells revealed by the last move (or line / batch of moves)
+    std::int32_t threeBV{0};      ///< 3BV of the layout, see Board::getThreeBV()
+};
+
+static_assert(sizeof(GameStatus) == 10 * sizeof(std::int32_t), "GameStatus must stay a plain array of int32");
+
+#endif // GAMESTATUS_H
@@ -1,3 +1,6 @@
+#ifndef INPUTDATA_H
+#define INPUTDATA_H
+
 /**
  * @brief Represents parsed user input for a minesweeper game move
  *
@@ -11,7 +14,8 @@ struct InputData
      * @brief Column index on the board (0-based)
      *
      * Represents the horizontal position on the game board.
-     * Corresponds to letters A-Z in user input, converted to 0-based index.
+     * Corresponds to letters A..Z, AA, AB, ... (or a 1-based number) in user
+     * input, converted to 0-based index.
      *
      * @note Range: 0 to (board_width - 1)
      */
@@ -21,7 +25,7 @@ struct InputData
      * @brief Row index on the board (0-based)
      *
      * Represents the vertical position on the game board.
-     * Corresponds to numbers 1-26 in user input, converted to 0-based index.
+     * Corresponds to 1-based row numbers in user input, converted to 0-based index.
      *
      * @note Range: 0 to (board_height - 1)
      */
@@ -33,8 +37,11 @@ struct InputData
      * Defines what operation to execute on the cell at the given coordinates.
      * - 'R': Reveal the cell (default action if not specified)
      * - 'F': Toggle flag on the cell
+     * - 'C': Chord, reveal the neighbours of a number whose mines are flagged
      *
-     * @note Valid values: 'R' (reveal) or 'F' (flag)
+     * @note Valid values: 'R' (reveal), 'F' (flag) or 'C' (chord)
      */
     char action;
-};
\ No newline at end of file
+};
+
+#endif // INPUTDATA_H
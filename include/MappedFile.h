@@ -0,0 +1,50 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Read-only view of a whole file, memory-mapped where the platform allows
+ *
+ * On POSIX systems the file is mapped with mmap(), so its pages are only
+ * read when touched and never copied into a separate buffer. Elsewhere
+ * (Windows builds) the file is read into memory instead; callers see the
+ * same span either way.
+ */
+class MappedFile
+{
+private:
+    // * Properties
+    const std::uint8_t *data{nullptr}; ///< Start of the mapping (or of fallback)
+    std::size_t size{0};               ///< File size in bytes
+    bool mapped{false};                ///< data must be unmapped on destruction
+    std::vector<std::uint8_t> fallback; ///< File contents where mmap() is not used
+
+public:
+    /**
+     * @brief Opens and maps a file
+     * @param path File to map
+     * @throws std::runtime_error If the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string &path);
+
+    /**
+     * @brief Unmaps the file
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Gets the file contents
+     * @return std::span<const std::uint8_t> Valid while the MappedFile lives
+     */
+    std::span<const std::uint8_t> bytes() const { return {data, size}; }
+};
+
+#endif // MAPPEDFILE_H
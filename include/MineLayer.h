@@ -0,0 +1,151 @@
+#ifndef MINELAYER_H
+#define MINELAYER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Random.h"
+
+/**
+ * @brief Bit-plane representation of the mines of a board
+ *
+ * Stores one bit per cell, row by row, with every row padded to a whole
+ * number of 64-bit words. Besides fast membership tests during mine
+ * placement, it feeds the vectorised neighbour counting kernel used by
+ * Board::setNumber, which computes the numbers of a full row at once.
+ */
+class MineLayer
+{
+private:
+    // * Properties
+    int columns{0};                   ///< Number of columns covered by the layer
+    int rows{0};                      ///< Number of rows covered by the layer
+    std::size_t wordsPerRow{0};       ///< 64-bit words used by every (padded) row
+    std::vector<std::uint64_t> bits;  ///< Row-major mine bits, bit c%64 of word c/64
+
+public:
+    /**
+     * @brief Constructs an empty (mine-free) layer for the given dimensions
+     * @param columns Number of columns (width)
+     * @param rows Number of rows (height)
+     */
+    MineLayer(int columns, int rows);
+
+    // * Getters
+
+    /**
+     * @brief Gets the number of 64-bit words stored per row
+     * @return std::size_t Words per row, including padding
+     */
+    std::size_t getWordsPerRow() const { return wordsPerRow; }
+
+    /**
+     * @brief Gets the packed words of a row
+     * @param row Row index (0-based)
+     * @return const std::uint64_t* Pointer to getWordsPerRow() words
+     */
+    const std::uint64_t *getRow(int row) const { return &bits[static_cast<std::size_t>(row) * wordsPerRow]; }
+
+    /**
+     * @brief Checks whether a cell holds a mine
+     * @param column Column index (0-based)
+     * @param row Row index (0-based)
+     * @return bool True if the bit of the cell is set
+     */
+    bool test(int column, int row) const
+    {
+        return (getRow(row)[column >> 6] >> (column & 63)) & 1u;
+    }
+
+    /**
+     * @brief Gets the raw words of the layer, row by row
+     * @return std::span<const std::byte> rows * getWordsPerRow() words in host byte order
+     */
+    std::span<const std::byte> getBytes() const { return std::as_bytes(std::span(bits)); }
+
+    // * Setters
+
+    /**
+     * @brief Overwrites the layer with raw words (e.g. from a save)
+     * @param bytes Exactly getBytes().size() bytes, as returned by getBytes()
+     */
+    void setBytes(std::span<const std::byte> bytes);
+
+    /**
+     * @brief Marks a cell as holding a mine
+     * @param column Column index (0-based)
+     * @param row Row index (0-based)
+     */
+    void set(int column, int row)
+    {
+        bits[static_cast<std::size_t>(row) * wordsPerRow + (column >> 6)] |= std::uint64_t{1} << (column & 63);
+    }
+
+    /**
+     * @brief Removes every mine from the layer without releasing memory
+     */
+    void clear();
+
+    /**
+     * @brief Adds exactly `count` mines on distinct, uniformly random cells
+     *
+     * Uses Floyd's sampling algorithm: for each j in [cells - count, cells)
+     * it draws t in [0, j] and takes t, or j itself if t is already a mine.
+     * That is exactly one draw per mine, so the cost is O(count) at any density.
+     *
+     * @param count Number of mines to place
+     * @param rng Engine the positions are drawn from
+     * @pre The layer is empty and 0 <= count <= columns * rows
+     */
+    void scatter(int count, SplitMix64 &rng);
+
+    /**
+     * @brief Adds exactly `count` mines uniformly among the cells not excluded
+     *
+     * Runs the same Floyd sampling over the cells - excluded.size() allowed
+     * cells, mapping each sampled rank to a cell by skipping the excluded
+     * offsets (at most a handful, e.g. a safe zone around the first click).
+     *
+     * @param count Number of mines to place
+     * @param rng Engine the positions are drawn from
+     * @param excluded Row-major offsets (row * columns + column) that stay mine-free, sorted and distinct
+     * @pre The layer is empty and 0 <= count <= columns * rows - excluded.size()
+     */
+    void scatter(int count, SplitMix64 &rng, std::span<const std::uint32_t> excluded);
+
+    // * Utils
+
+    /**
+     * @brief Expands a row of bits into one byte (0 or 1) per cell
+     *
+     * Rows outside the board expand to zeros, which lets callers treat the
+     * board edges as mine-free padding.
+     *
+     * @param row Row index (may be -1 or rows for padding)
+     * @param out Destination of getColumns() bytes
+     */
+    void expandRow(int row, std::uint8_t *out) const;
+
+    /**
+     * @brief Computes the neighbour counts of one row from three expanded rows
+     *
+     * Each input row holds `columns + 2` bytes: a zero byte, the expanded
+     * row and another zero byte. The kernel first adds the three rows
+     * vertically and then adds the vertical sums shifted left and right,
+     * subtracting the centre cell. Uses AVX2 or SSE2 when the build enables
+     * them and a scalar loop otherwise.
+     *
+     * @param above Padded row above the counted one
+     * @param current Padded row being counted
+     * @param below Padded row below the counted one
+     * @param columnSums Scratch buffer of `columns + 2` bytes
+     * @param out Destination of `columns` counts (0-8)
+     * @param columns Number of cells in the row
+     */
+    static void countNeighbours(const std::uint8_t *above, const std::uint8_t *current, const std::uint8_t *below,
+                                std::uint8_t *columnSums, std::uint8_t *out, int columns);
+};
+
+#endif // MINELAYER_H
@@ -0,0 +1,137 @@
+#ifndef MOVEJOURNAL_H
+#define MOVEJOURNAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "CellChange.h"
+#include "InputData.h"
+
+/**
+ * @brief History of a game as a compact journal of moves and the cells they changed
+ *
+ * Each move that changed something is one Entry: the move itself and the
+ * range of its CellChange records inside a single shared log. Undoing or
+ * redoing an entry only walks its own records, so it costs O(cells it
+ * changed) whatever the board size.
+ *
+ * To bound the cost of jumping far through the history, a packed snapshot
+ * of the visible state (two bits per cell, see Board::packVisibleState) is
+ * kept whenever the log has grown by a quarter of the board's cell count
+ * since the last one: restoring a snapshot costs about as much as replaying
+ * that many records, and snapshots never take more memory than the log.
+ *
+ * The journal only stores; Game applies entries to the board.
+ */
+class MoveJournal
+{
+public:
+    /**
+     * @brief One recorded move
+     */
+    struct Entry
+    {
+        InputData move;            ///< The move as played
+        std::uint32_t firstChange; ///< Offset of its first record in the log
+        std::uint32_t changeCount; ///< Number of records
+    };
+
+    /**
+     * @brief Visible state of the board at some point of the history
+     */
+    struct Snapshot
+    {
+        std::size_t position;            ///< Entries applied when it was taken
+        std::vector<std::uint8_t> cells; ///< Board::packVisibleState() at that point
+    };
+
+private:
+    // * Properties
+    std::vector<Entry> entries;        ///< Every recorded move, applied or undone
+    std::vector<CellChange> log;       ///< Change records of all entries, in order
+    std::vector<Snapshot> snapshots;   ///< Ordered by position
+    std::size_t position{0};           ///< Entries currently applied; later ones can be redone
+
+public:
+    /**
+     * @brief Forgets the whole history (storage is kept)
+     */
+    void clear();
+
+    /**
+     * @brief Appends a move after the current position, dropping any redo history
+     * @param move The move
+     * @param changes What it changed (see Game::getChanges)
+     */
+    void record(const InputData &move, std::span<const CellChange> changes);
+
+    /**
+     * @brief Checks whether a snapshot should be taken at the current position
+     * @param cells Cells of the board
+     * @return bool True once the log grew by cells / 4 records since the last snapshot
+     */
+    bool wantsSnapshot(std::size_t cells) const;
+
+    /**
+     * @brief Stores a snapshot for the current position
+     * @param cells Packed visible state (moved in)
+     */
+    void addSnapshot(std::vector<std::uint8_t> &&cells);
+
+    /**
+     * @brief Finds the latest snapshot taken at or before a position
+     * @param target Position
+     * @return const Snapshot* Snapshot, or nullptr if none
+     */
+    const Snapshot *snapshotBefore(std::size_t target) const;
+
+    /**
+     * @brief Counts the change records between two positions
+     * @param from First position
+     * @param to Second position (either order)
+     * @return std::size_t Records to walk to go from one to the other
+     */
+    std::size_t changesBetween(std::size_t from, std::size_t to) const;
+
+    /**
+     * @brief Gets the change records of an entry
+     * @param entry Entry index (0-based)
+     * @return std::span<const CellChange> Its records, in the order they happened
+     */
+    std::span<const CellChange> changesOf(std::size_t entry) const;
+
+    /**
+     * @brief Gets a recorded move
+     * @param entry Entry index (0-based)
+     * @return const Entry& The entry
+     */
+    const Entry &getEntry(std::size_t entry) const { return entries[entry]; }
+
+    /**
+     * @brief Moves the current position (Game has applied or undone the entries in between)
+     * @param newPosition Entries now applied
+     */
+    void setPosition(std::size_t newPosition) { position = newPosition; }
+
+    /**
+     * @brief Gets the number of entries currently applied
+     * @return std::size_t Position in the history
+     */
+    std::size_t getPosition() const { return position; }
+
+    /**
+     * @brief Gets the number of recorded entries, including undone ones
+     * @return std::size_t History length
+     */
+    std::size_t size() const { return entries.size(); }
+
+    /**
+     * @brief Gets the number of stored snapshots
+     * @return std::size_t Snapshot count
+     */
+    std::size_t getSnapshotCount() const { return snapshots.size(); }
+};
+
+#endif // MOVEJOURNAL_H
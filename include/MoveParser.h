@@ -0,0 +1,163 @@
+#ifndef MOVEPARSER_H
+#define MOVEPARSER_H
+
+#include <charconv>
+#include <cstdint>
+#include <string_view>
+
+#include "Coordinates.h"
+#include "InputData.h"
+
+/**
+ * @brief Hand-written, allocation-free parsers for moves and board sizes
+ *
+ * A line holds one or more moves separated by spaces, e.g. "A1 B2F C3 R".
+ * Each move is a coordinate followed by an optional action:
+ * - Coordinate: spreadsheet column letters and a 1-based row ("AB12"), or a
+ *   1-based numeric pair ("28,12")
+ * - Action: F (flag), R (reveal, the default) or C (chord), either attached
+ *   ("B2F") or after a space ("B2 F"). A lone letter is an action; a letter
+ *   followed by digits starts the next move.
+ *
+ * Letters are accepted in either case. Parsing works on std::string_view
+ * and std::from_chars only, so it neither allocates nor throws.
+ */
+namespace MoveParser
+{
+    /**
+     * @brief Outcome of parsing the next move of a line
+     */
+    enum class Result : std::uint8_t
+    {
+        Move,   ///< A move was parsed
+        End,    ///< Only whitespace was left
+        Invalid ///< The text is not a valid move
+    };
+
+    constexpr bool isDigit(char ch) { return ch >= '0' && ch <= '9'; }
+    constexpr bool isLetter(char ch) { return (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z'); }
+    constexpr bool isSpace(char ch) { return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n'; }
+    constexpr char toUpper(char ch) { return ch >= 'a' && ch <= 'z' ? static_cast<char>(ch - 'a' + 'A') : ch; }
+
+    /**
+     * @brief Drops leading whitespace
+     * @param text Text to trim in place
+     */
+    constexpr void skipSpaces(std::string_view &text)
+    {
+        while (!text.empty() && isSpace(text.front()))
+            text.remove_prefix(1);
+    }
+
+    /**
+     * @brief Consumes a run of digits as a positive int
+     * @param text Text to consume from
+     * @param value Receives the number
+     * @return bool False if there are no digits or the number does not fit an int
+     */
+    inline bool consumeNumber(std::string_view &text, int &value)
+    {
+        if (text.empty() || !isDigit(text.front()))
+            return false;
+
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc{})
+            return false;
+
+        text.remove_prefix(static_cast<std::size_t>(end - text.data()));
+        return true;
+    }
+
+    /**
+     * @brief Checks whether text starts with a standalone action letter
+     * @param text Text after the coordinate (and any spaces)
+     * @return char The action, or 0 if the text does not start with one
+     */
+    constexpr char actionAt(std::string_view text)
+    {
+        if (text.empty())
+            return 0;
+
+        const char action = toUpper(text.front());
+        if (action != 'F' && action != 'R' && action != 'C')
+            return 0;
+
+        return text.size() == 1 || isSpace(text[1]) ? action : 0;
+    }
+
+    /**
+     * @brief Parses the next move of a line
+     * @param text Remaining text; advanced past the move on success
+     * @param move Receives the 0-based column and row and the action
+     * @return Result Move, End when nothing but whitespace is left, or Invalid
+     */
+    inline Result next(std::string_view &text, InputData &move)
+    {
+        skipSpaces(text);
+        if (text.empty())
+            return Result::End;
+
+        int column = 0;
+        int row = 0;
+
+        if (isDigit(text.front()))
+        {
+            // Numeric pair: column,row (both 1-based)
+            if (!consumeNumber(text, column) || text.empty() || text.front() != ',')
+                return Result::Invalid;
+            text.remove_prefix(1);
+            if (!consumeNumber(text, row))
+                return Result::Invalid;
+        }
+        else
+        {
+            // Spreadsheet style: letters for the column, then the row number
+            std::size_t letters = 0;
+            while (letters < text.size() && isLetter(text[letters]))
+                ++letters;
+
+            column = Coordinates::parseColumnLabel(text.substr(0, letters)) + 1;
+            text.remove_prefix(letters);
+            if (column <= 0 || !consumeNumber(text, row))
+                return Result::Invalid;
+        }
+
+        move.column = column - 1;
+        move.row = row - 1;
+        move.action = 'R';
+
+        // Attached action ("B2F") or one separated by spaces ("B2 F")
+        std::string_view candidate = text;
+        skipSpaces(candidate);
+        if (const char action = actionAt(candidate))
+        {
+            move.action = action;
+            text = candidate.substr(1);
+        }
+
+        return text.empty() || isSpace(text.front()) ? Result::Move : Result::Invalid;
+    }
+
+    /**
+     * @brief Parses a board size such as "10x8" (or "10X8")
+     * @param text Size text; surrounding whitespace is ignored
+     * @param columns Receives the number of columns
+     * @param rows Receives the number of rows
+     * @return bool False if the text is not number x number or a number does not fit an int
+     */
+    inline bool parseSize(std::string_view text, int &columns, int &rows)
+    {
+        skipSpaces(text);
+        if (!consumeNumber(text, columns) || text.empty() || toUpper(text.front()) != 'X')
+            return false;
+
+        text.remove_prefix(1);
+        if (!consumeNumber(text, rows))
+            return false;
+
+        skipSpaces(text);
+        return text.empty();
+    }
+}
+
+#endif // MOVEPARSER_H
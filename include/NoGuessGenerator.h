@@ -0,0 +1,90 @@
+#ifndef NOGUESSGENERATOR_H
+#define NOGUESSGENERATOR_H
+
+#include <cstdint>
+
+/**
+ * @brief Finds boards that the Solver clears from the first click without guessing
+ *
+ * Candidates are ordinary safe-start boards (see Board's first-click
+ * constructor) generated from a sequence of seeds derived from a base seed.
+ * Each candidate is played by the Solver alone, starting with the first
+ * click; it is accepted if the Solver reveals every safe cell.
+ *
+ * Candidates are checked in parallel. Threads claim attempt numbers from a
+ * shared counter and the lowest successful attempt wins; threads stop
+ * claiming once an attempt below theirs has succeeded. The chosen board
+ * therefore depends only on the base seed, never on the thread count or
+ * timing, so a base seed always reproduces the same no-guess board.
+ */
+class NoGuessGenerator
+{
+public:
+    /**
+     * @brief Outcome of a search
+     */
+    struct Result
+    {
+        bool found{false};         ///< True if a solvable board was found within the attempt limit
+        std::uint64_t seed{0};     ///< Board seed of the solvable board (valid if found)
+        std::uint64_t attempt{0};  ///< Attempt number of the board (candidates rejected before it)
+    };
+
+private:
+    // * Properties
+    int columns;     ///< Board width
+    int rows;        ///< Board height
+    int mines;       ///< Mines per board
+    int startColumn; ///< Column of the first click
+    int startRow;    ///< Row of the first click
+
+public:
+    /**
+     * @brief Constructs a generator for one board shape and first click
+     * @param columns Number of columns of the boards
+     * @param rows Number of rows of the boards
+     * @param mines Number of mines of the boards
+     * @param startColumn Column of the first click (0-based)
+     * @param startRow Row of the first click (0-based)
+     */
+    NoGuessGenerator(int columns, int rows, int mines, int startColumn, int startRow);
+
+    /**
+     * @brief Gets the board seed tried by a given attempt
+     * @param baseSeed Seed the search started from
+     * @param attempt Attempt number (0-based)
+     * @return std::uint64_t The attempt-th output of SplitMix64(baseSeed)
+     */
+    static std::uint64_t candidateSeed(std::uint64_t baseSeed, std::uint64_t attempt);
+
+    /**
+     * @brief Suggests an attempt limit that bounds the total work of a search
+     *
+     * Checking a candidate costs time proportional to its area, and large
+     * boards are rarely guess-free at common densities, so the limit shrinks
+     * as boards grow: about 2^24 cells are examined at most.
+     *
+     * @param columns Number of columns of the boards
+     * @param rows Number of rows of the boards
+     * @return std::uint64_t Attempts, between 8 and 100000
+     */
+    static std::uint64_t defaultAttempts(int columns, int rows);
+
+    /**
+     * @brief Plays one candidate with the Solver only
+     * @param seed Board seed
+     * @return bool True if the Solver wins from the first click without guessing
+     */
+    bool isSolvable(std::uint64_t seed) const;
+
+    /**
+     * @brief Searches for the first solvable candidate
+     * @param baseSeed Seed of the candidate sequence
+     * @param maxAttempts Candidates to try before giving up
+     * @param threads Worker threads (0 = one per hardware thread)
+     * @return Result The lowest successful attempt, or found == false
+     */
+    Result generate(std::uint64_t baseSeed, std::uint64_t maxAttempts = 100000, unsigned threads = 0) const;
+};
+
+#endif // NOGUESSGENERATOR_H
@@ -0,0 +1,123 @@
+#ifndef PROBABILITYENGINE_H
+#define PROBABILITYENGINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Board.h"
+
+/**
+ * @brief Exact per-cell mine probabilities from the player-visible board
+ *
+ * Used when the Solver finds no safe move. The frontier (hidden cells next
+ * to revealed numbers) is split into independent components: two cells are
+ * in the same component when some number touches both. For every component
+ * all consistent mine assignments are enumerated by backtracking, counting
+ * solutions per number of mines used. Components are then combined exactly,
+ * weighting each total by the number of ways, C(U, M - s), to place the
+ * remaining mines among the U hidden cells away from the frontier.
+ *
+ * The combination runs over a product tree of the components' distributions,
+ * restricted to the feasible totals. Each distribution is first tilted
+ * towards the likely totals, so tails below 1e-30 of the peak can be dropped;
+ * the distributions then stay about as wide as the spread of the total, not
+ * the whole frontier, and thousands of components combine in milliseconds.
+ * Components too large to enumerate within the node budget use the interior
+ * density.
+ *
+ * Enumeration results are cached by component signature (cells and numbers),
+ * so a move that does not touch a component reuses its previous result.
+ */
+class ProbabilityEngine
+{
+private:
+    /**
+     * @brief Enumeration result of one component
+     */
+    struct ComponentResult
+    {
+        std::vector<std::uint32_t> signature; ///< Cells and numbers the result was computed for
+        std::vector<double> ways;             ///< Solutions using k mines, scaled so the largest is 1
+        std::vector<double> cellWays;         ///< [k * cells + i]: solutions with k mines where cell i is a mine
+        bool exact{true};                     ///< False if the node budget ran out (cells then use the interior density)
+        bool used{false};                     ///< Touched by the last compute(); unused entries are evicted
+    };
+
+    /**
+     * @brief A component of the current frontier
+     */
+    struct Component
+    {
+        std::vector<std::uint32_t> cells;       ///< Hidden cells (buffer offsets), in enumeration order
+        std::vector<std::uint32_t> constraints; ///< Numbers (buffer offsets) touching the cells
+        const ComponentResult *result{nullptr}; ///< Cached enumeration
+    };
+
+    // * Properties
+    const Board &board;                                        ///< Board being analysed (only visible state is read)
+    std::size_t nodeBudget;                                    ///< Backtracking nodes allowed per component
+    std::vector<double> probability;                           ///< Mine probability per cell (0 for revealed cells)
+    std::vector<std::int32_t> frontierId;                      ///< Union-find parent per frontier cell, -1 elsewhere
+    std::vector<Component> components;                         ///< Components of the last compute()
+    std::unordered_map<std::uint64_t, ComponentResult> cache;  ///< Enumerations by signature hash
+    std::size_t cacheHits{0};                                  ///< Components served from the cache
+    std::size_t cacheMisses{0};                                ///< Components enumerated
+
+    // * Internals
+    std::int32_t find(std::int32_t cell);
+    void buildComponents();
+    const ComponentResult &resultFor(const Component &component);
+    ComponentResult enumerate(const Component &component) const;
+    void combine();
+
+public:
+    /**
+     * @brief Constructs an engine bound to a board
+     * @param board Board to analyse; must outlive the engine
+     * @param nodeBudget Backtracking nodes allowed per component before falling back to density
+     */
+    explicit ProbabilityEngine(const Board &board, std::size_t nodeBudget = 2'000'000);
+
+    /**
+     * @brief Recomputes all probabilities from the current visible state
+     */
+    void compute();
+
+    /**
+     * @brief Gets the mine probability of a cell, as of the last compute()
+     * @param column Column index (0-based)
+     * @param row Row index (0-based)
+     * @return double Probability in [0, 1]; 0 for revealed cells
+     */
+    double getProbability(int column, int row) const { return probability[board.index(column, row)]; }
+
+    /**
+     * @brief Finds the hidden cell least likely to be a mine
+     * @param column Receives the column of the cell
+     * @param row Receives the row of the cell
+     * @return bool False if no hidden cell is left
+     */
+    bool bestGuess(int &column, int &row) const;
+
+    /**
+     * @brief Gets the number of frontier components of the last compute()
+     * @return std::size_t Component count
+     */
+    std::size_t getComponentCount() const { return components.size(); }
+
+    /**
+     * @brief Gets how many components were served from the cache since construction
+     * @return std::size_t Cache hits
+     */
+    std::size_t getCacheHits() const { return cacheHits; }
+
+    /**
+     * @brief Gets how many components had to be enumerated since construction
+     * @return std::size_t Cache misses
+     */
+    std::size_t getCacheMisses() const { return cacheMisses; }
+};
+
+#endif // PROBABILITYENGINE_H
@@ -0,0 +1,80 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Small, seedable counter-based random number generator (SplitMix64)
+ *
+ * Each output is a bijective mix of a counter that advances by a fixed odd
+ * constant, so the generator is a single 64-bit word, never needs warm-up
+ * and produces the same sequence on every platform and standard library.
+ * Satisfies UniformRandomBitGenerator, so it also works with <random>.
+ */
+class SplitMix64
+{
+private:
+    std::uint64_t counter; ///< Current position in the sequence
+
+public:
+    using result_type = std::uint64_t;
+
+    /**
+     * @brief Constructs the generator at the start of the sequence for a seed
+     * @param seed Any 64-bit value; equal seeds give equal sequences
+     */
+    explicit SplitMix64(std::uint64_t seed = 0) : counter(seed) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    /**
+     * @brief Restarts the sequence from a new seed
+     * @param seed Any 64-bit value
+     */
+    void seed(std::uint64_t seed) { counter = seed; }
+
+    /**
+     * @brief Produces the next 64 random bits
+     * @return result_type Uniformly distributed 64-bit value
+     */
+    result_type operator()()
+    {
+        std::uint64_t z = (counter += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief Produces an unbiased integer in [0, bound)
+     *
+     * Uses Lemire's multiply-and-shift reduction with rejection, which avoids
+     * the division of the modulo method and is identical on all platforms
+     * (unlike std::uniform_int_distribution).
+     *
+     * @param bound Exclusive upper limit
+     * @return std::uint32_t Value in [0, bound)
+     * @pre bound > 0
+     */
+    std::uint32_t bounded(std::uint32_t bound)
+    {
+        std::uint64_t product = (operator()() >> 32) * bound;
+        auto low = static_cast<std::uint32_t>(product);
+
+        if (low < bound)
+        {
+            const std::uint32_t threshold = static_cast<std::uint32_t>(-bound) % bound;
+            while (low < threshold)
+            {
+                product = (operator()() >> 32) * bound;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+};
+
+#endif // RANDOM_H
@@ -0,0 +1,111 @@
+#ifndef REPLAYFORMAT_H
+#define REPLAYFORMAT_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "InputData.h"
+
+/**
+ * @brief Binary replay format shared by ReplayWriter and ReplayReader
+ *
+ * A replay is a header followed by one record per move, until the end of
+ * the file. Integers are unsigned LEB128 varints; signed deltas are
+ * zigzag-encoded first, so small steps in either direction take one byte.
+ *
+ * Header:
+ * - "MSRP", then a version byte (Version) and a flags byte (Flag*)
+ * - varints: columns, rows, mines, seed
+ * - FlagSafeStart: varints safe column and safe row (the board was generated
+ *   with that first click and its neighbours mine-free)
+ * - FlagLayout: (columns * rows + 7) / 8 bytes of mine bits, cell i in bit
+ *   i % 8 of byte i / 8 (the board does not depend on the generator then)
+ * - FlagHistory: the game had undo enabled, so records may undo / redo
+ *
+ * Record:
+ * - varint key = zigzag(column - previous column) << 3 | action code
+ * - reveal, flag and chord only: varint zigzag(row - previous row)
+ * - varint milliseconds since the previous record
+ *
+ * Undo and redo records carry no coordinates (their key is the bare action
+ * code). A typical click takes three or four bytes.
+ */
+namespace ReplayFormat
+{
+    inline constexpr std::array<char, 4> Magic{'M', 'S', 'R', 'P'};
+    inline constexpr std::uint8_t Version = 1;
+
+    inline constexpr std::uint8_t FlagSafeStart = 1 << 0;
+    inline constexpr std::uint8_t FlagLayout = 1 << 1;
+    inline constexpr std::uint8_t FlagHistory = 1 << 2;
+
+    /// Action codes of a record; InputData uses the characters 'R', 'F', 'C', 'U' (undo) and 'Y' (redo)
+    inline constexpr std::array<char, 5> Actions{'R', 'F', 'C', 'U', 'Y'};
+    inline constexpr int ActionBits = 3;
+
+    /**
+     * @brief Board description stored at the start of a replay
+     */
+    struct Header
+    {
+        int columns{0};
+        int rows{0};
+        int mines{0};
+        std::uint64_t seed{0};
+        int safeColumn{-1};               ///< -1 if the board had no safe first click
+        int safeRow{-1};
+        bool history{false};              ///< Records may contain undo / redo
+        std::vector<std::uint8_t> layout; ///< Packed mine bits, empty if the seed is enough
+    };
+
+    /**
+     * @brief One decoded move
+     */
+    struct Record
+    {
+        InputData move;          ///< 0-based coordinates (0 for undo / redo) and action character
+        std::uint32_t elapsedMs; ///< Time since the previous record
+    };
+
+    /**
+     * @brief Maps an action character to its code
+     * @param action 'R', 'F', 'C', 'U' or 'Y'
+     * @return int Code, or -1 if the action is unknown
+     */
+    constexpr int actionCode(char action)
+    {
+        for (int code = 0; code < static_cast<int>(Actions.size()); ++code)
+            if (Actions[code] == action)
+                return code;
+        return -1;
+    }
+
+    constexpr std::uint64_t zigzag(std::int64_t value)
+    {
+        return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+    constexpr std::int64_t unzigzag(std::uint64_t value)
+    {
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    /**
+     * @brief Appends an unsigned LEB128 varint
+     * @param out Destination bytes
+     * @param value Value to encode (1 byte below 128, at most 10 bytes)
+     */
+    inline void putVarint(std::string &out, std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out += static_cast<char>(value | 0x80);
+            value >>= 7;
+        }
+        out += static_cast<char>(value);
+    }
+}
+
+#endif // REPLAYFORMAT_H
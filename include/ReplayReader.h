@@ -0,0 +1,83 @@
+#ifndef REPLAYREADER_H
+#define REPLAYREADER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Game.h"
+#include "MineLayer.h"
+#include "ReplayFormat.h"
+
+/**
+ * @brief Decodes a replay written by ReplayWriter
+ *
+ * The whole file is kept in memory and records are decoded on demand with
+ * a few shifts per varint, so playback speed is bound by the game engine,
+ * not by parsing. Malformed data throws std::runtime_error.
+ */
+class ReplayReader
+{
+private:
+    // * Properties
+    std::vector<std::uint8_t> data; ///< Raw replay bytes
+    std::size_t recordsBegin{0};    ///< Offset of the first record
+    std::size_t cursor{0};          ///< Offset of the next record
+    ReplayFormat::Header header;    ///< Decoded header
+    int lastColumn{0};              ///< Column of the previous record
+    int lastRow{0};                 ///< Row of the previous record
+
+    // * Internals
+    std::uint64_t readVarint();
+    MineLayer storedLayout() const;
+
+public:
+    /**
+     * @brief Parses the header of a replay held in memory
+     * @param bytes Replay bytes (moved in)
+     * @throws std::runtime_error If the header is missing or invalid
+     */
+    explicit ReplayReader(std::vector<std::uint8_t> bytes);
+
+    /**
+     * @brief Loads a replay file
+     * @param path File written by ReplayWriter
+     * @return ReplayReader Reader positioned at the first record
+     * @throws std::runtime_error If the file cannot be read or is not a replay
+     */
+    static ReplayReader fromFile(const std::string &path);
+
+    /**
+     * @brief Gets the board description
+     * @return const ReplayFormat::Header& Header of the replay
+     */
+    const ReplayFormat::Header &getHeader() const { return header; }
+
+    /**
+     * @brief Builds the game the replay was recorded on, before its first move
+     * @return Game Same board (from the seed or the stored layout); history enabled if the replay undoes
+     */
+    Game createGame() const;
+
+    /**
+     * @brief Puts a game made by createGame() back on the replay's starting board, without allocating
+     * @param game Game with the replay's dimensions
+     */
+    void restart(Game &game) const;
+
+    /**
+     * @brief Decodes the next record
+     * @param record Receives the move and its time delta
+     * @return bool False at the end of the replay
+     * @throws std::runtime_error If the replay ends in the middle of a record
+     */
+    bool next(ReplayFormat::Record &record);
+
+    /**
+     * @brief Goes back to the first record
+     */
+    void rewind();
+};
+
+#endif // REPLAYREADER_H
@@ -0,0 +1,67 @@
+#ifndef REPLAYWRITER_H
+#define REPLAYWRITER_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "Game.h"
+#include "InputData.h"
+#include "ReplayFormat.h"
+
+/**
+ * @brief Streams a game to the binary replay format while it is played
+ *
+ * The header is written on construction; after that Game calls append()
+ * for every move it applies (see Game::setRecorder), so the file is
+ * complete up to the last move even if the program stops. Each record is
+ * encoded into a reused buffer and handed to the stream in one write.
+ */
+class ReplayWriter
+{
+private:
+    // * Properties
+    std::ostream &out;                                ///< Destination (e.g. a binary std::ofstream)
+    std::string buffer;                               ///< Encoded bytes of the current record, reused
+    int lastColumn{0};                                ///< Column of the previous record (deltas start at 0)
+    int lastRow{0};                                   ///< Row of the previous record
+    std::chrono::steady_clock::time_point lastMove;   ///< Time of the previous record (or of construction)
+
+public:
+    /**
+     * @brief Writes the header describing a game's board
+     * @param out Destination stream, opened in binary mode
+     * @param game Game about to be recorded; call before its first move
+     * @param embedLayout Store the mine bits as well, so the replay does not depend on the generator
+     */
+    ReplayWriter(std::ostream &out, const Game &game, bool embedLayout = false);
+
+    /**
+     * @brief Flushes the stream
+     */
+    ~ReplayWriter() { flush(); }
+
+    ReplayWriter(const ReplayWriter &) = delete;
+    ReplayWriter &operator=(const ReplayWriter &) = delete;
+
+    /**
+     * @brief Records a move, timestamped now
+     * @param move 0-based coordinates and action ('R', 'F', 'C', or 'U' / 'Y' for undo / redo)
+     */
+    void append(const InputData &move);
+
+    /**
+     * @brief Records a move with an explicit time since the previous one
+     * @param move 0-based coordinates and action
+     * @param elapsedMs Milliseconds since the previous record
+     */
+    void append(const InputData &move, std::uint32_t elapsedMs);
+
+    /**
+     * @brief Flushes the underlying stream
+     */
+    void flush() { out.flush(); }
+};
+
+#endif // REPLAYWRITER_H
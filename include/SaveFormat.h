@@ -0,0 +1,81 @@
+#ifndef SAVEFORMAT_H
+#define SAVEFORMAT_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Binary save format used by Game::save() and Game::load()
+ *
+ * A save is the engine's own memory image of a game, so loading it is a
+ * couple of block copies with no per-cell parsing:
+ * - Header (64 bytes, host byte order, which is little-endian everywhere
+ *   the game builds, WASM included)
+ * - columns * rows bytes: the packed cells exactly as Board stores them
+ *   (see Cell.h)
+ * - zero padding to a multiple of 8 bytes
+ * - rows * wordsPerRow 64-bit words: the mine bit-plane (see MineLayer)
+ *
+ * The header holds the counters, so nothing has to be recounted either.
+ * The undo history and the 3BV cache are not saved.
+ */
+namespace SaveFormat
+{
+    inline constexpr std::array<char, 4> Magic{'M', 'S', 'S', 'V'};
+    inline constexpr std::uint16_t Version = 1;
+
+    inline constexpr std::uint16_t FlagHistory = 1 << 0; ///< The game had undo enabled (its journal starts empty)
+
+    static_assert(std::endian::native == std::endian::little, "Saves are little-endian memory images");
+
+    /**
+     * @brief Fixed-size header at the start of a save
+     */
+    struct Header
+    {
+        std::array<char, 4> magic{Magic};
+        std::uint16_t version{Version};
+        std::uint16_t flags{0};
+        std::uint64_t seed{0};             ///< Seed the layout was generated from
+        std::int32_t columns{0};
+        std::int32_t rows{0};
+        std::int32_t mines{0};
+        std::int32_t safeColumn{-1};       ///< Mine-free first click, -1 if none
+        std::int32_t safeRow{-1};
+        std::int32_t revealedSafe{0};      ///< Board counters, see Board::getRevealedSafeCount() and friends
+        std::int32_t flagged{0};
+        std::int32_t hidden{0};
+        std::int32_t state{0};             ///< GameState value
+        std::int32_t moves{0};             ///< Moves played so far
+        std::int32_t elapsedMs{0};         ///< Time played so far; the clock resumes from it
+        std::int32_t wordsPerRow{0};       ///< MineLayer words per row
+    };
+
+    static_assert(sizeof(Header) == 64, "The save header has a fixed layout");
+
+    /**
+     * @brief Gets the offset of the mine words
+     * @param header Header of the save
+     * @return std::size_t Bytes of header and cells, rounded up to 8
+     */
+    constexpr std::size_t layerOffset(const Header &header)
+    {
+        const std::size_t cells = static_cast<std::size_t>(header.columns) * static_cast<std::size_t>(header.rows);
+        return (sizeof(Header) + cells + 7) / 8 * 8;
+    }
+
+    /**
+     * @brief Gets the total size of a save
+     * @param header Header of the save
+     * @return std::size_t Bytes of the whole file
+     */
+    constexpr std::size_t fileSize(const Header &header)
+    {
+        return layerOffset(header) + static_cast<std::size_t>(header.rows) *
+                                             static_cast<std::size_t>(header.wordsPerRow) * sizeof(std::uint64_t);
+    }
+}
+
+#endif // SAVEFORMAT_H
@@ -0,0 +1,120 @@
+#ifndef SESSIONMANAGER_H
+#define SESSIONMANAGER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "BoardLimits.h"
+#include "Game.h"
+#include "GamePool.h"
+
+/**
+ * @brief Independent games addressed by id, driven by a text line protocol
+ *
+ * Every request is one line and gets exactly one response line, starting
+ * with "OK" or "ERR <reason>". Ids are decimal numbers handed out by CREATE.
+ *
+ * - `CREATE <columns> <rows> [mines] [seed]` -> `OK <id> <seed>`
+ *   (mines default to 12.5 % of the cells, the seed to a random one)
+ * - `PLAY <id> <moves>` -> `OK <state> <cells changed>`; moves use the
+ *   player syntax ("A1 B2F 3,4C", see MoveParser)
+ * - `BATCH <id> <column> <row> <action> ...` -> `OK <played> <state>`;
+ *   0-based integers and R, F or C, played with Game::playBatch()
+ * - `STATUS <id>` -> `OK` and the ten GameStatus fields in their order
+ * - `VIEW <id>` -> `OK <columns> <rows> <cells>`, one character per cell,
+ *   row-major: '#' hidden, 'F' flagged, '*' revealed mine, '0'-'8' revealed
+ * - `CLOSE <id>` -> `OK`
+ *
+ * States are GameState values (0 playing, 1 won, 2 lost). Commands are
+ * case-insensitive.
+ *
+ * The manager caps both the number of open games and their total cells, so
+ * a client cannot exhaust memory with a stream of large boards; CREATE
+ * answers "ERR too many sessions" or "ERR too many cells" beyond them.
+ *
+ * Closed games go back to a GamePool, so a CREATE after a CLOSE of the same
+ * shape regenerates the old board in place instead of allocating a new one.
+ *
+ * handle() may be called from many threads at once: the id table is behind
+ * a shared mutex and each game behind its own, so requests on different
+ * sessions run in parallel and a session is never played by two threads.
+ */
+class SessionManager
+{
+private:
+    /**
+     * @brief One hosted game and the lock serialising its requests
+     */
+    struct Session
+    {
+        std::mutex lock;
+        GamePool::Lease game;
+        std::size_t cells{0}; ///< columns * rows, counted in openCells while the session is open
+    };
+
+    // * Properties
+    BoardLimits limits;                                                    ///< Accepted board sizes
+    std::size_t maxSessions;                                               ///< CREATE fails beyond this many
+    std::size_t maxCells;                                                  ///< ... or beyond this many cells open
+    std::size_t openCells{0};                                              ///< Cells of the open games (tableLock)
+    GamePool pool;                                                         ///< Storage of closed games, reused by CREATE
+    mutable std::shared_mutex tableLock;                                   ///< Guards sessions
+    std::unordered_map<std::uint32_t, std::shared_ptr<Session>> sessions; ///< Open games by id
+    std::atomic<std::uint32_t> nextId{1};                                  ///< Id of the next CREATE
+
+    // * Internals
+    std::shared_ptr<Session> find(std::uint32_t id) const;
+    void create(std::string_view arguments, std::string &out, std::vector<std::uint32_t> &owned);
+    static void play(Game &game, std::string_view moves, std::string &out);
+    static void batch(Game &game, std::string_view arguments, std::string &out);
+    static void status(const Game &game, std::string &out);
+    static void view(const Game &game, std::string &out);
+
+public:
+    /**
+     * @brief Constructs an empty manager
+     * @param limits Board sizes CREATE accepts
+     * @param maxSessions Largest number of games open at once
+     * @param maxCells Largest total number of cells of the open games (2^28 by default, a few hundred MB)
+     */
+    explicit SessionManager(BoardLimits limits = {}, std::size_t maxSessions = 1'000'000,
+                            std::size_t maxCells = std::size_t{1} << 28);
+
+    /**
+     * @brief Executes one request line
+     * @param line Request without the line terminator
+     * @param out Receives the response line, including its '\n' (appended, so responses can be batched)
+     * @param owned Ids created by this call are appended and ids it closes removed (lets a connection close
+     *              its games when it leaves)
+     */
+    void handle(std::string_view line, std::string &out, std::vector<std::uint32_t> &owned);
+
+    /**
+     * @brief Closes games (ids that are already closed are ignored)
+     * @param ids Sessions to close
+     */
+    void close(std::span<const std::uint32_t> ids);
+
+    /**
+     * @brief Gets the number of open games
+     * @return std::size_t Session count
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets the counters of the game pool behind CREATE and CLOSE
+     * @return GamePool::Stats Games created, reused and kept idle
+     */
+    GamePool::Stats getPoolStats() const { return pool.getStats(); }
+};
+
+#endif // SESSIONMANAGER_H
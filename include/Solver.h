@@ -0,0 +1,136 @@
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Board.h"
+#include "CellChange.h"
+
+/**
+ * @brief Deterministic constraint-propagation solver over the player-visible board
+ *
+ * The Solver only reads what a player can see: which cells are revealed and
+ * the numbers on revealed cells. Player flags are ignored (they may be
+ * wrong); the solver keeps its own record of cells it proved to be safe or
+ * mines. Two rules are applied:
+ * - Single cell: a number whose remaining mines equal 0 (or equal its
+ *   unknown neighbours) makes all those neighbours safe (or mines).
+ * - Pairs: for two numbers X and Y at most two cells apart, if
+ *   need(Y) - need(X) equals |Y \ X| then Y \ X are mines and X \ Y are safe.
+ *   This includes the classic subset/superset rule.
+ *
+ * Work is incremental: only numbers around cells reported through
+ * notifyRevealed() (or around new deductions) are re-examined, so each move
+ * costs time proportional to what it changed. Used by bots, hints and
+ * board-quality checks.
+ */
+class Solver
+{
+private:
+    /**
+     * @brief What the solver has proven about a cell
+     */
+    enum Knowledge : std::uint8_t
+    {
+        Unknown, ///< Nothing proven yet
+        Safe,    ///< Proven to hold no mine
+        Mine     ///< Proven to hold a mine
+    };
+
+    /**
+     * @brief Unknown neighbours of a number, as a mask over the 7x7 window of the examined cell
+     */
+    struct Constraint
+    {
+        std::uint64_t unknown{0}; ///< Bit (dr + 3) * 7 + (dc + 3) for each unknown neighbour
+        int need{0};              ///< Mines still missing among the unknown neighbours
+    };
+
+    // * Properties
+    const Board &board;                   ///< Board being solved (only visible state is read)
+    int columns;                          ///< Cached board width
+    int rows;                             ///< Cached board height
+    std::vector<std::uint8_t> knowledge;  ///< Knowledge value per cell
+    std::vector<std::uint8_t> queued;     ///< 1 if the cell is already in the dirty worklist
+    std::vector<std::uint32_t> dirty;     ///< Numbers to (re)examine
+    std::vector<std::uint32_t> safeCells; ///< Proven safe cells, in discovery order
+    std::vector<std::uint32_t> mineCells; ///< Proven mines, in discovery order
+    std::size_t safeCursor{0};            ///< Next entry of safeCells handed out by nextSafeCell()
+    std::uint64_t deductions{0};          ///< Total cells proven since the last reset()
+
+    // * Internals
+    bool isNumber(int column, int row) const;
+    void enqueue(int column, int row);
+    void enqueueAround(int column, int row);
+    Constraint constraintOf(int column, int row, int originColumn, int originRow) const;
+    int apply(std::uint64_t mask, int originColumn, int originRow, Knowledge value);
+    int examine(std::uint32_t index);
+
+public:
+    /**
+     * @brief Constructs a solver bound to a board and scans its visible state
+     * @param board Board to solve; must outlive the solver
+     */
+    explicit Solver(const Board &board);
+
+    /**
+     * @brief Forgets all deductions and re-queues every revealed number
+     *
+     * Needed after the board was regenerated or changed without
+     * notifications; O(cells).
+     */
+    void reset();
+
+    /**
+     * @brief Reports cells that became revealed since the last call
+     * @param changes Changes of the last move, e.g. Game::getChanges(); flag changes are ignored
+     */
+    void notifyRevealed(std::span<const CellChange> changes);
+
+    /**
+     * @brief Runs the rules until no queued number yields anything new
+     * @return int Number of cells proven safe or mine by this call
+     */
+    int solve();
+
+    /**
+     * @brief Hands out the next proven safe cell that is still hidden
+     * @param column Receives the column of the cell
+     * @param row Receives the row of the cell
+     * @return bool False if no such cell is known (call solve() first)
+     */
+    bool nextSafeCell(int &column, int &row);
+
+    /**
+     * @brief Checks whether a cell was proven safe
+     * @param column Column index (0-based)
+     * @param row Row index (0-based)
+     * @return bool True if proven safe
+     */
+    bool isKnownSafe(int column, int row) const;
+
+    /**
+     * @brief Checks whether a cell was proven to hold a mine
+     * @param column Column index (0-based)
+     * @param row Row index (0-based)
+     * @return bool True if proven mine
+     */
+    bool isKnownMine(int column, int row) const;
+
+    /**
+     * @brief Gets the proven mines, in discovery order
+     * @return const std::vector<std::uint32_t>& Buffer offsets
+     */
+    const std::vector<std::uint32_t> &getKnownMines() const { return mineCells; }
+
+    /**
+     * @brief Gets the number of cells proven since the last reset()
+     * @return std::uint64_t Deduction count
+     */
+    std::uint64_t getDeductionCount() const { return deductions; }
+};
+
+#endif // SOLVER_H
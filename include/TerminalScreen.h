@@ -0,0 +1,78 @@
+#ifndef TERMINALSCREEN_H
+#define TERMINALSCREEN_H
+
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+
+#include "Board.h"
+#include "BoardRenderer.h"
+#include "CellChange.h"
+
+/**
+ * @brief Interactive terminal front end that redraws only what changed
+ *
+ * The game runs on the terminal's alternate screen buffer. The first frame
+ * is drawn in full; after that each move only rewrites the cells it
+ * changed, addressing them with cursor-positioning escape sequences, so
+ * the cost of a redraw is proportional to the changed cells and no
+ * external process (clear/cls) is spawned. The area below the board is
+ * cleared and left for the prompt and messages.
+ *
+ * When the board does not fit in the terminal, cursor addressing cannot
+ * reach every cell, so every update falls back to a full frame (still
+ * drawn with escape sequences and one write).
+ */
+class TerminalScreen
+{
+private:
+    // * Properties
+    std::ostream &out;      ///< Terminal stream
+    BoardRenderer renderer; ///< Full frames
+    std::string commands;   ///< Escape sequences and glyphs of the pending update, reused
+    bool open{false};       ///< True while the alternate screen is active
+    bool partial{false};    ///< True if the board fits, so cells can be addressed individually
+
+    // * Internals
+    void appendMoveTo(int line, int column);
+    void appendFullFrame(const Board &board);
+    void appendPromptArea(const Board &board);
+    void flush();
+    static bool fitsTerminal(const Board &board);
+
+public:
+    /**
+     * @brief Constructs a screen writing to a terminal stream
+     * @param out Terminal stream (std::cout by default)
+     */
+    explicit TerminalScreen(std::ostream &out = std::cout) : out(out) {}
+
+    /**
+     * @brief Leaves the alternate screen if still active
+     */
+    ~TerminalScreen() { close(); }
+
+    TerminalScreen(const TerminalScreen &) = delete;
+    TerminalScreen &operator=(const TerminalScreen &) = delete;
+
+    /**
+     * @brief Switches to the alternate screen and draws the full board
+     * @param board Board to show
+     */
+    void show(const Board &board);
+
+    /**
+     * @brief Redraws the given cells and clears the prompt area
+     * @param board Board after the move
+     * @param changed Cells the move changed, e.g. Game::getChanges()
+     */
+    void update(const Board &board, std::span<const CellChange> changed);
+
+    /**
+     * @brief Restores the normal screen (the game's frames disappear with it)
+     */
+    void close();
+};
+
+#endif // TERMINALSCREEN_H
@@ -0,0 +1,37 @@
+#ifndef CHANGEREASON_H
+#define CHANGEREASON_H
+
+#include <cstdint>
+
+/**
+ * @brief Why a cell's visible state changed during a move (see CellChange)
+ */
+enum class ChangeReason : std::uint8_t
+{
+    /**
+     * @brief A safe cell was revealed (directly, by flood fill or by a chord)
+     */
+    Revealed,
+
+    /**
+     * @brief A flag was placed on a hidden cell
+     */
+    Flagged,
+
+    /**
+     * @brief A flag was removed
+     */
+    Unflagged,
+
+    /**
+     * @brief A mine was revealed; the game is lost
+     */
+    Exploded,
+
+    /**
+     * @brief A revealed cell was hidden again (undo, see Game::undo)
+     */
+    Hidden
+};
+
+#endif // CHANGEREASON_H
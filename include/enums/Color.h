@@ -1,8 +1,10 @@
 #ifndef COLOR_H
 #define COLOR_H
 
-#include <string>
+#include <array>
+#include <cstddef>
 #include <ostream>
+#include <string_view>
 
 /**
  * @brief ANSI color codes for terminal text formatting in minesweeper
@@ -74,46 +76,43 @@ enum class Color
     Reset
 };
 
+/**
+ * @brief ANSI escape sequences indexed by Color
+ *
+ * Compile-time table, so renderers can append a colour to a frame buffer
+ * without building a string per use.
+ */
+inline constexpr std::array<std::string_view, 10> AnsiCodes{
+    "\033[34m",   // Blue text
+    "\033[32m",   // Green text
+    "\033[31m",   // Red text
+    "\033[34;1m", // Bold blue text
+    "\033[31;1m", // Bold red text
+    "\033[36m",   // Cyan text
+    "\033[30m",   // Black text
+    "\033[90m",   // Bright black (gray) text
+    "\033[33m",   // Yellow text
+    "\033[0m",    // Reset all formatting
+};
+
 /**
  * @brief Converts a Color enum value to its corresponding ANSI escape sequence
  *
  * @param c The color to convert
- * @return std::string ANSI escape sequence for the specified color
+ * @return std::string_view ANSI escape sequence for the specified color
  *
- * @note Returns empty string for invalid/unknown colors
+ * @note Returns an empty view for invalid/unknown colors, and for every color
+ *       when NO_ANSI_COLORS is defined
  */
-inline std::string toAnsi(Color c)
+constexpr std::string_view toAnsi(Color c)
 {
 #ifdef NO_ANSI_COLORS
     // In web or environments without ANSI support, return empty sequences
     (void)c;
-    return "";
+    return {};
 #else
-    switch (c)
-    {
-    case Color::Blue:
-        return "\033[34m"; // Blue text
-    case Color::Green:
-        return "\033[32m"; // Green text
-    case Color::Red:
-        return "\033[31m"; // Red text
-    case Color::Navy:
-        return "\033[34;1m"; // Bold blue text
-    case Color::Maroon:
-        return "\033[31;1m"; // Bold red text
-    case Color::Teal:
-        return "\033[36m"; // Cyan text
-    case Color::Black:
-        return "\033[30m"; // Black text
-    case Color::Gray:
-        return "\033[90m"; // Bright black (gray) text
-    case Color::Yellow:
-        return "\033[33m"; // Yellow text
-    case Color::Reset:
-        return "\033[0m"; // Reset all formatting
-    default:
-        return ""; // No formatting for unknown colors
-    }
+    const auto index = static_cast<std::size_t>(c);
+    return index < AnsiCodes.size() ? AnsiCodes[index] : std::string_view{};
 #endif
 }
 
@@ -135,7 +134,7 @@ inline std::string toAnsi(Color c)
  * - 7: Black
  * - 8: Gray
  */
-inline Color colorForNumber(int n)
+constexpr Color colorForNumber(int n)
 {
     switch (n)
     {
@@ -0,0 +1,53 @@
+#ifndef MOVEOUTCOME_H
+#define MOVEOUTCOME_H
+
+#include <cstdint>
+
+/**
+ * @brief Compact result of one move of a batch (see Game::playBatch)
+ *
+ * One byte per move, so a batch's results can be read from JavaScript as a
+ * Uint8Array over the WASM heap.
+ */
+enum class MoveOutcome : std::uint8_t
+{
+    /**
+     * @brief The move was legal but changed nothing
+     *
+     * E.g. revealing an already revealed cell, or a chord whose number
+     * does not have all its mines flagged.
+     */
+    None,
+
+    /**
+     * @brief One or more cells were revealed
+     */
+    Revealed,
+
+    /**
+     * @brief A flag was placed
+     */
+    Flagged,
+
+    /**
+     * @brief A flag was removed
+     */
+    Unflagged,
+
+    /**
+     * @brief A mine was revealed and the game is lost
+     */
+    Exploded,
+
+    /**
+     * @brief The coordinates are outside the board or the action is unknown
+     */
+    Invalid,
+
+    /**
+     * @brief Not played because the game had already ended
+     */
+    Skipped
+};
+
+#endif // MOVEOUTCOME_H
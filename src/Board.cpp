@@ -6,74 +6,253 @@
  */
 
 #include "Board.h"
+#include "BoardRenderer.h"
 
-#include <iomanip>
-#include <iostream>
+#include <algorithm>
+#include <bit>
+#include <cstring>
 #include <random>
+#include <string>
+#include <type_traits>
 
 #include "enums/CellContent.h"
 #include "Game.h"
-#include "enums/Color.h"
 
 // Constructor - initializes the board entity
-Board::Board(int columns, int rows, int mines) : columns(columns), rows(rows), mines(mines)
+Board::Board(int columns, int rows, int mines, std::uint64_t seed)
+    : columns(columns), rows(rows), mines(std::clamp(mines, 0, columns * rows)), mineLayer(columns, rows),
+      seed(seed), rng(seed)
 {
-    // C++17 Class Template Argument Deduction! (CTAD)
-    board = std::vector(rows, std::vector(columns, Cell(CellContent::Empty)));
-    setMines();
+    reset(seed);
+}
+
+Board::Board(int columns, int rows, int mines, std::uint64_t seed, int safeColumn, int safeRow)
+    : columns(columns), rows(rows), mines(std::clamp(mines, 0, columns * rows)), mineLayer(columns, rows),
+      seed(seed), rng(seed)
+{
+    reset(seed, safeColumn, safeRow);
+}
+
+// Saves copy the cell buffer as it is in memory
+static_assert(sizeof(Cell) == 1 && std::is_trivially_copyable_v<Cell>, "Cells must be plain bytes");
+
+Board::Board(const SaveFormat::Header &header, std::span<const std::uint8_t> save)
+    : columns(header.columns), rows(header.rows), mines(header.mines),
+      board(static_cast<std::size_t>(header.columns) * header.rows, Cell(CellContent::Empty)),
+      mineLayer(header.columns, header.rows), revealedSafeCells(header.revealedSafe), flaggedCells(header.flagged),
+      hiddenCells(header.hidden), seed(header.seed), rng(header.seed), safeColumn(header.safeColumn),
+      safeRow(header.safeRow)
+{
+    std::memcpy(board.data(), save.data() + sizeof(SaveFormat::Header), board.size());
+    mineLayer.setBytes(std::as_bytes(save.subspan(SaveFormat::layerOffset(header))));
+}
+
+void Board::reset(std::uint64_t newSeed)
+{
+    safeColumn = safeRow = -1;
+    regenerate(newSeed, {});
+}
+
+void Board::reset(std::uint64_t newSeed, int safeColumn, int safeRow)
+{
+    this->safeColumn = safeColumn;
+    this->safeRow = safeRow;
+
+    // The first click and its neighbours, in row-major (sorted) order
+    std::array<std::uint32_t, 9> safeZone{};
+    std::size_t zoneSize = 0;
+    for (int r = std::max(0, safeRow - 1); r <= std::min(rows - 1, safeRow + 1); ++r)
+        for (int c = std::max(0, safeColumn - 1); c <= std::min(columns - 1, safeColumn + 1); ++c)
+            safeZone[zoneSize++] = static_cast<std::uint32_t>(index(c, r));
+
+    mines = minesFitting(columns, rows, mines, safeColumn, safeRow);
+    regenerate(newSeed, std::span<const std::uint32_t>(safeZone.data(), zoneSize));
+}
+
+void Board::regenerate(std::uint64_t newSeed, std::span<const std::uint32_t> excluded)
+{
+    seed = newSeed;
+    rng.seed(newSeed);
+    revealedSafeCells = 0;
+    flaggedCells = 0;
+    hiddenCells = columns * rows;
+    threeBV = -1;
+
+    // Single contiguous allocation, one byte per cell, made once; setNumber() overwrites every cell
+    board.resize(static_cast<std::size_t>(columns) * rows, Cell(CellContent::Empty));
+    mineLayer.clear();
+    setMines(excluded);
+    setNumber();
+}
+
+void Board::reset(const MineLayer &layout)
+{
+    safeColumn = safeRow = -1;
+    revealedSafeCells = 0;
+    flaggedCells = 0;
+    hiddenCells = columns * rows;
+    threeBV = -1;
+
+    mineLayer = layout;
+    mines = 0;
+    for (int r = 0; r < rows; ++r)
+        for (std::size_t w = 0; w < mineLayer.getWordsPerRow(); ++w)
+            mines += std::popcount(mineLayer.getRow(r)[w]);
+
     setNumber();
 }
 
 // * Getters
 int Board::getColumns() const { return columns; }
 int Board::getRows() const { return rows; }
-Cell Board::getCell(int column, int row) const { return board[row][column]; }
-Cell &Board::getCell(int column, int row) { return board[row][column]; }
+Cell Board::getCell(int column, int row) const { return board[index(column, row)]; }
+Cell &Board::getCell(int column, int row) { return board[index(column, row)]; }
 CellContent Board::getCellContent(int column, int row) const { return getCell(column, row).getContent(); }
-std::vector<std::vector<Cell>> Board::getBoard() const { return board; }
+const std::vector<Cell> &Board::getBoard() const { return board; }
 int Board::getMines() const { return mines; }
+std::uint64_t Board::getSeed() const { return seed; }
+const MineLayer &Board::getMineLayer() const { return mineLayer; }
 
-// * Setters
-void Board::setCellContent(int column, int row, CellContent content) { getCell(column, row).setContent(content); }
-
-void Board::setMines()
+int Board::getThreeBV() const
 {
-    int includedMines = 0;
+    if (threeBV >= 0)
+        return threeBV;
 
-    while (includedMines < mines)
+    // Openings first: each flood fill over empty cells also marks the numbers it borders
+    threeBVMarks.assign((board.size() + 63) / 64, 0);
+    std::vector<std::uint32_t> &pending = threeBVPending;
+    const auto mark = [this](std::size_t i) {
+        std::uint64_t &word = threeBVMarks[i / 64];
+        const std::uint64_t bit = std::uint64_t{1} << (i % 64);
+        const bool seen = word & bit;
+        word |= bit;
+        return seen;
+    };
+    int clicks = 0;
+
+    for (std::size_t start = 0; start < board.size(); ++start)
     {
-        // C++17 structured bindings for more beautiful and cleaner code
-        const auto [column, row] = generateRandomCoordinates();
+        if (!board[start].isEmpty() || mark(start))
+            continue;
+
+        ++clicks;
+        pending.push_back(static_cast<std::uint32_t>(start));
 
-        Cell &cell = getCell(column, row);
-        if (!cell.isMine())
+        while (!pending.empty())
         {
-            cell.setContent(CellContent::Mine);
-            ++includedMines;
+            const std::uint32_t current = pending.back();
+            pending.pop_back();
+
+            const int c = static_cast<int>(current % columns);
+            const int r = static_cast<int>(current / columns);
+            for (int nr = std::max(0, r - 1); nr <= std::min(rows - 1, r + 1); ++nr)
+            {
+                for (int nc = std::max(0, c - 1); nc <= std::min(columns - 1, c + 1); ++nc)
+                {
+                    const std::size_t neighbor = index(nc, nr);
+                    if (!mark(neighbor) && board[neighbor].isEmpty())
+                        pending.push_back(static_cast<std::uint32_t>(neighbor));
+                }
+            }
         }
     }
+
+    // Numbers no opening reaches need a click each
+    for (std::size_t i = 0; i < board.size(); ++i)
+        clicks += board[i].isNumber() && !(threeBVMarks[i / 64] >> (i % 64) & 1);
+
+    threeBV = clicks;
+    return threeBV;
 }
 
-void Board::setNumber()
+// * Setters
+void Board::setCellContent(int column, int row, CellContent content) { getCell(column, row).setContent(content); }
+
+bool Board::toggleFlag(std::size_t index)
 {
-    for (int r = 0; r < rows; ++r)
+    Cell &cell = board[index];
+    if (cell.isRevealed())
+        return false;
+
+    cell.toggleFlag();
+    const int delta = cell.isFlagged() ? 1 : -1;
+    flaggedCells += delta;
+    hiddenCells -= delta;
+    return true;
+}
+
+void Board::packVisibleState(std::vector<std::uint8_t> &packed) const
+{
+    packed.assign((board.size() + 3) / 4, 0);
+    for (std::size_t i = 0; i < board.size(); ++i)
     {
-        for (int c = 0; c < columns; ++c)
-        {
-            Cell &cell = getCell(c, r);
+        const int code = board[i].isRevealed() ? 1 : board[i].isFlagged() ? 2 : 0;
+        packed[i / 4] |= static_cast<std::uint8_t>(code << (2 * (i % 4)));
+    }
+}
 
-            if (cell.isMine())
-                continue;
+void Board::saveTo(SaveFormat::Header &header, std::span<std::uint8_t> save) const
+{
+    header.seed = seed;
+    header.columns = columns;
+    header.rows = rows;
+    header.mines = mines;
+    header.safeColumn = safeColumn;
+    header.safeRow = safeRow;
+    header.revealedSafe = revealedSafeCells;
+    header.flagged = flaggedCells;
+    header.hidden = hiddenCells;
+    header.wordsPerRow = static_cast<std::int32_t>(mineLayer.getWordsPerRow());
 
-            int mines = calculateNearbyMines(c, r);
+    const std::span<const std::byte> words = mineLayer.getBytes();
+    std::memcpy(save.data() + sizeof(SaveFormat::Header), board.data(), board.size());
+    std::memcpy(save.data() + SaveFormat::layerOffset(header), words.data(), words.size());
+}
 
-            if (mines > 0)
-            {
-                cell.setContent(CellContent::Number);
-            }
+void Board::setMines(std::span<const std::uint32_t> excluded)
+{
+    // Only the bit-plane is touched here; setNumber() copies mines into the cells row by row
+    if (excluded.empty())
+        mineLayer.scatter(mines, rng);
+    else
+        mineLayer.scatter(mines, rng, excluded);
+}
 
-            cell.setNearbyMines(mines);
+void Board::setNumber()
+{
+    // Rolling window of three zero-padded rows plus the kernel's scratch and output rows
+    const std::size_t padded = static_cast<std::size_t>(columns) + 2;
+    numberScratch.assign(padded * 5, 0);
+    std::uint8_t *scratch = numberScratch.data();
+    std::array<std::uint8_t *, 3> window{scratch, scratch + padded, scratch + 2 * padded};
+    std::uint8_t *columnSums = scratch + 3 * padded;
+    std::uint8_t *counts = scratch + 4 * padded;
+
+    // Every generated cell is one of ten values: hidden Empty/Number with 0-8 mines, or a hidden Mine
+    std::array<Cell, 10> generated{
+        Cell(CellContent::Empty), Cell(CellContent::Number), Cell(CellContent::Number),
+        Cell(CellContent::Number), Cell(CellContent::Number), Cell(CellContent::Number),
+        Cell(CellContent::Number), Cell(CellContent::Number), Cell(CellContent::Number),
+        Cell(CellContent::Mine)};
+    for (int n = 0; n <= 8; ++n)
+        generated[n].setNearbyMines(n);
+
+    mineLayer.expandRow(0, window[1] + 1);
+
+    for (int r = 0; r < rows; ++r)
+    {
+        mineLayer.expandRow(r + 1, window[2] + 1);
+        MineLayer::countNeighbours(window[0], window[1], window[2], columnSums, counts, columns);
+
+        Cell *line = &board[index(0, r)];
+        const std::uint8_t *isMine = window[1] + 1;
+
+        for (int c = 0; c < columns; ++c)
+        {
+            line[c] = generated[isMine[c] ? 9 : counts[c]];
         }
+
+        std::ranges::rotate(window, window.begin() + 1);
     }
 }
 
@@ -85,25 +264,26 @@ int Board::calculateNearbyMines(int column, int row)
 
     int mines{0};
 
-    // Check all 8 adjacent cells (3x3 grid minus center)
-    for (int r = -1; r <= 1; ++r)
+    // Clip the 3x3 window to the board once instead of checking every neighbour
+    const int firstColumn = column > 0 ? column - 1 : 0;
+    const int lastColumn = column < columns - 1 ? column + 1 : column;
+    const int firstRow = row > 0 ? row - 1 : 0;
+    const int lastRow = row < rows - 1 ? row + 1 : row;
+
+    for (int r = firstRow; r <= lastRow; ++r)
     {
-        for (int c = -1; c <= 1; ++c)
+        const Cell *line = &board[index(0, r)];
+        for (int c = firstColumn; c <= lastColumn; ++c)
         {
-            if (!isValidBoardCoordinate(column + c, row + r))
-                continue;
-
-            if (c == 0 && r == 0) // Skip center cell. It is unnecessary!
-                continue;
-
-            Cell &cell = getCell(column + c, row + r);
-
-            if (cell.isMine())
-            {
+            if (line[c].isMine())
                 ++mines;
-            }
         }
     }
+
+    // The center cell never counts towards its own number
+    if (board[index(column, row)].isMine())
+        --mines;
+
     return mines;
 }
 
@@ -114,94 +294,33 @@ bool Board::isValidBoardCoordinate(int column, int row) const
 
 void Board::print() const
 {
-    // Board rendering with borders and labels
-    const int drawColumns = columns + 3;
-    const int drawRows = rows + 3;
-
-    for (int r = 0; r < drawRows; ++r)
-    {
-        for (int c = 0; c < drawColumns; ++c)
-        {
-            if (r == 0 && c == 0)
-            {
-                std::cout << "   ";
-            }
-            // Column headers (A, B, C, ...)
-            else if (r == 0 && c > 1 && c < drawColumns - 1)
-            {
-                char letter = 'A' + (c - 2);
-                std::cout << Color::Yellow << " " << letter << Color::Reset << " ";
-            }
-            // Row numbers (1, 2, 3, ...)
-            else if (c == 0 && r > 1 && r < drawRows - 1)
-            {
-                std::cout << Color::Yellow << " " << std::setw(2) << r - 1 << Color::Reset;
-            }
-            // Border corners
-            else if ((r == 1 || r == drawRows - 1) && (c == 1 || c == drawColumns - 1))
-            {
-                std::cout << " + ";
-            }
-            // Horizontal borders
-            else if (r == 1 || r == drawRows - 1)
-            {
-                std::cout << " - ";
-            }
-            // Vertical borders
-            else if (c == 1 || c == drawColumns - 1)
-            {
-                std::cout << " | ";
-            }
-            // Game cells
-            else
-            {
-                int innerRow = r - 2;
-                int innerColumn = c - 2;
-
-                Cell cell = getCell(innerColumn, innerRow);
-
-                if (cell.isHidden())
-                {
-                    std::cout << " # ";
-                    continue;
-                }
-
-                if (cell.isFlagged())
-                {
-                    std::cout << Color::Red << " F " << Color::Reset;
-                    continue;
-                }
+    BoardRenderer renderer;
+    renderer.draw(*this);
+}
 
-                if (cell.getContent() == CellContent::Mine)
-                {
-                    std::cout << " * ";
-                    continue;
-                }
+std::array<int, 2> Board::generateRandomCoordinates()
+{
+    const auto column = static_cast<int>(rng.bounded(static_cast<std::uint32_t>(columns)));
+    const auto row = static_cast<int>(rng.bounded(static_cast<std::uint32_t>(rows)));
 
-                if (cell.getContent() == CellContent::Number && cell.getNearbyMines() > 0)
-                {
-                    Color mineColor = colorForNumber(cell.getNearbyMines());
-                    std::cout << " " << mineColor << cell.getNearbyMines() << Color::Reset << " ";
-                }
-                else
-                {
-                    // Empty cell
-                    std::cout << "   ";
-                }
-            }
-        }
-        std::cout << "\n";
-    }
+    return {column, row};
 }
 
-std::array<int, 2> Board::generateRandomCoordinates() const
+std::uint64_t Board::randomSeed()
 {
     // Modern C++ random number generation (no srand)
     std::random_device rd;
-    std::mt19937 gen(rd());
+    return (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+}
 
-    std::uniform_int_distribution distRow(0, rows - 1);
-    std::uniform_int_distribution distColumn(0, columns - 1);
+int Board::minesFitting(int columns, int rows, int mines, int safeColumn, int safeRow)
+{
+    const int fitting = std::clamp(mines, 0, columns * rows);
+    if (safeColumn < 0 && safeRow < 0)
+        return fitting;
 
-    return {distColumn(gen), distRow(gen)};
-}
\ No newline at end of file
+    // Same zone reset() keeps free: the first click and its neighbours inside the board
+    const int zoneColumns = std::max(0, std::min(columns - 1, safeColumn + 1) - std::max(0, safeColumn - 1) + 1);
+    const int zoneRows = std::max(0, std::min(rows - 1, safeRow + 1) - std::max(0, safeRow - 1) + 1);
+    return std::min(fitting, columns * rows - zoneColumns * zoneRows);
+}
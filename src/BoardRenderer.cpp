@@ -0,0 +1,148 @@
+/**
+ * @file BoardRenderer.cpp
+ * @brief Implementation of the buffered board renderer
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "BoardRenderer.h"
+
+#include <algorithm>
+#include <charconv>
+
+#include "Coordinates.h"
+#include "enums/Color.h"
+
+// * Pieces
+int BoardRenderer::labelWidth(int rows)
+{
+    char digits[16];
+    const auto rowDigits = static_cast<int>(std::to_chars(digits, digits + sizeof digits, rows).ptr - digits);
+    return std::max(2, rowDigits);
+}
+
+void BoardRenderer::appendCell(std::string &frame, Cell cell)
+{
+    if (cell.isHidden())
+    {
+        frame += " # ";
+        return;
+    }
+
+    if (cell.isFlagged())
+    {
+        frame += toAnsi(Color::Red);
+        frame += " F ";
+        frame += toAnsi(Color::Reset);
+        return;
+    }
+
+    if (cell.isMine())
+    {
+        frame += " * ";
+        return;
+    }
+
+    const int nearby = cell.getNearbyMines();
+    if (cell.getContent() == CellContent::Number && nearby > 0)
+    {
+        frame += ' ';
+        frame += toAnsi(colorForNumber(nearby));
+        frame += static_cast<char>('0' + nearby);
+        frame += toAnsi(Color::Reset);
+        frame += ' ';
+        return;
+    }
+
+    // Empty cell
+    frame += "   ";
+}
+
+// * Rendering
+template <typename CellAt>
+std::string_view BoardRenderer::renderGrid(int columns, int rows, CellAt cellAt)
+{
+    const int width = labelWidth(rows);
+    char digits[16];
+
+    frame.clear();
+
+    // Column headers (A, B, ..., Z, AA, AB, ...) kept three characters wide
+    frame.append(width + 1, ' ');
+    frame += " | ";
+    std::string label;
+    for (int c = 0; c < columns; ++c)
+    {
+        label.clear();
+        Coordinates::appendColumnLabel(label, c);
+        const int left = label.size() < 3 ? 1 : 0;
+        const int right = std::max(0, 3 - left - static_cast<int>(label.size()));
+        frame += toAnsi(Color::Yellow);
+        frame.append(left, ' ');
+        frame += label;
+        frame += toAnsi(Color::Reset);
+        frame.append(right, ' ');
+    }
+    frame += " | \n";
+
+    // Horizontal border, drawn above and below the cells
+    const std::size_t borderStart = frame.size();
+    frame += " -  + ";
+    for (int c = 0; c < columns; ++c)
+        frame += " - ";
+    frame += " + \n";
+    const std::size_t borderLength = frame.size() - borderStart;
+
+    for (int r = 0; r < rows; ++r)
+    {
+        // Row numbers (1, 2, 3, ...) right-aligned to the widest label
+        char *end = std::to_chars(digits, digits + sizeof digits, r + 1).ptr;
+        frame += toAnsi(Color::Yellow);
+        frame += ' ';
+        frame.append(static_cast<std::size_t>(width - (end - digits)), ' ');
+        frame.append(digits, end);
+        frame += toAnsi(Color::Reset);
+        frame += " | ";
+
+        cellAt(r, [this](Cell cell) { appendCell(frame, cell); });
+
+        frame += " | \n";
+    }
+
+    frame.append(frame, borderStart, borderLength);
+    return frame;
+}
+
+std::string_view BoardRenderer::render(const Board &board)
+{
+    const int columns = board.getColumns();
+    const std::vector<Cell> &cells = board.getBoard();
+
+    return renderGrid(columns, board.getRows(), [&](int row, auto append) {
+        const Cell *line = &cells[board.index(0, row)];
+        for (int c = 0; c < columns; ++c)
+            append(line[c]);
+    });
+}
+
+std::string_view BoardRenderer::render(ChunkedBoard &world, std::int64_t left, std::int64_t top, int columns,
+                                       int rows)
+{
+    return renderGrid(columns, rows, [&](int row, auto append) {
+        for (int c = 0; c < columns; ++c)
+        {
+            Cell cell = world.getCell(left + c, top + row);
+            // A lost world shows the mines in view, like Board does when a game is lost
+            if (world.isLost() && cell.isMine() && cell.isHidden())
+                cell.setState(CellState::Revealed);
+            append(cell);
+        }
+    });
+}
+
+void BoardRenderer::draw(const Board &board, std::ostream &out)
+{
+    const std::string_view text = render(board);
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    out.flush();
+}
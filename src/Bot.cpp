@@ -0,0 +1,79 @@
+/**
+ * @file Bot.cpp
+ * @brief Implementation of the automatic players
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "Bot.h"
+
+Bot::Bot(Game &game, Strategy strategy)
+    : game(game), strategy(strategy), solver(game.getBoard()), engine(game.getBoard()), rng(game.getSeed())
+{
+}
+
+void Bot::reset()
+{
+    if (strategy != Strategy::Random)
+        solver.reset();
+    rng.seed(game.getSeed());
+}
+
+// * Internals
+bool Bot::randomHiddenCell(int &column, int &row)
+{
+    const Board &board = game.getBoard();
+    const auto cells = static_cast<std::uint32_t>(board.getBoard().size());
+    if (board.getHiddenCount() == 0)
+        return false;
+
+    // Rejection sampling; proven mines are skipped too, as no strategy would click them
+    for (;;)
+    {
+        const std::uint32_t index = rng.bounded(cells);
+        column = static_cast<int>(index % board.getColumns());
+        row = static_cast<int>(index / board.getColumns());
+        if (board.getBoard()[index].isHidden() && (strategy == Strategy::Random || !solver.isKnownMine(column, row)))
+            return true;
+    }
+}
+
+bool Bot::nextMove(int &column, int &row)
+{
+    if (strategy == Strategy::Random)
+        return randomHiddenCell(column, row);
+
+    solver.solve();
+    if (solver.nextSafeCell(column, row))
+        return true;
+
+    if (strategy == Strategy::Probability)
+    {
+        engine.compute();
+        return engine.bestGuess(column, row);
+    }
+
+    return randomHiddenCell(column, row);
+}
+
+// * Interaction
+int Bot::playToEnd(int startColumn, int startRow)
+{
+    int moves = 0;
+    int column = startColumn;
+    int row = startRow;
+
+    do
+    {
+        game.play(column, row, 'R');
+        ++moves;
+        game.checkWinCondition();
+        if (!game.isPlaying())
+            break;
+
+        if (strategy != Strategy::Random)
+            solver.notifyRevealed(game.getChanges());
+    } while (nextMove(column, row));
+
+    return moves;
+}
@@ -8,27 +8,58 @@
 #include "Cell.h"
 
 // Constructor - initializes cell with content and state
-Cell::Cell(CellContent content, CellState state) : content(content), state(state) {}
+Cell::Cell(CellContent content, CellState state) : bits(encodeContent(content) | encodeState(state)) {}
+
+// * Encoding helpers - map enum values to their packed bit fields
+std::uint8_t Cell::encodeContent(CellContent content)
+{
+    return static_cast<std::uint8_t>(static_cast<std::uint8_t>(content) << ContentShift);
+}
+
+std::uint8_t Cell::encodeState(CellState state)
+{
+    switch (state)
+    {
+    case CellState::Revealed:
+        return 1 << StateShift;
+    case CellState::Flagged:
+        return 2 << StateShift;
+    default:
+        return 0;
+    }
+}
 
 // * Getters
-CellContent Cell::getContent() const { return content; }
-int Cell::getNearbyMines() const { return nearbyMines; }
-CellState Cell::getState() const { return state; }
+CellContent Cell::getContent() const { return static_cast<CellContent>((bits & ContentMask) >> ContentShift); }
+int Cell::getNearbyMines() const { return bits & CountMask; }
+
+CellState Cell::getState() const
+{
+    switch (bits & StateMask)
+    {
+    case 1 << StateShift:
+        return CellState::Revealed;
+    case 2 << StateShift:
+        return CellState::Flagged;
+    default:
+        return CellState::Hidden;
+    }
+}
 
-// State check methods - compare against enum values
-bool Cell::isHidden() const { return state == CellState::Hidden; }
-bool Cell::isRevealed() const { return state == CellState::Revealed; }
-bool Cell::isFlagged() const { return state == CellState::Flagged; }
+// State check methods - compare against packed bit fields
+bool Cell::isHidden() const { return (bits & StateMask) == 0; }
+bool Cell::isRevealed() const { return (bits & StateMask) == encodeState(CellState::Revealed); }
+bool Cell::isFlagged() const { return (bits & StateMask) == encodeState(CellState::Flagged); }
 
-// Content check methods - compare against enum values
-bool Cell::isMine() const { return content == CellContent::Mine; }
-bool Cell::isNumber() const { return content == CellContent::Number; }
-bool Cell::isEmpty() const { return content == CellContent::Empty; }
+// Content check methods - compare against packed bit fields
+bool Cell::isMine() const { return (bits & ContentMask) == encodeContent(CellContent::Mine); }
+bool Cell::isNumber() const { return (bits & ContentMask) == encodeContent(CellContent::Number); }
+bool Cell::isEmpty() const { return (bits & ContentMask) == encodeContent(CellContent::Empty); }
 
-// * Setters -
-void Cell::setContent(CellContent c) { content = c; }
-void Cell::setNearbyMines(int mines) { nearbyMines = mines; }
-void Cell::setState(CellState s) { state = s; }
+// * Setters - rewrite one field, keep the other two
+void Cell::setContent(CellContent c) { bits = (bits & ~ContentMask) | encodeContent(c); }
+void Cell::setNearbyMines(int mines) { bits = (bits & ~CountMask) | (static_cast<std::uint8_t>(mines) & CountMask); }
+void Cell::setState(CellState s) { bits = (bits & ~StateMask) | encodeState(s); }
 
 // * Utils
-void Cell::toggleFlag() { state = isFlagged() ? CellState::Hidden : CellState::Flagged; }
\ No newline at end of file
+void Cell::toggleFlag() { setState(isFlagged() ? CellState::Hidden : CellState::Flagged); }
@@ -0,0 +1,226 @@
+/**
+ * @file ChunkedBoard.cpp
+ * @brief Implementation of the lazily generated, chunked infinite board
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "ChunkedBoard.h"
+
+#include <algorithm>
+#include <array>
+
+namespace
+{
+    constexpr int Size = ChunkedBoard::ChunkSize;
+    constexpr int Padded = Size + 2;
+
+    // Same encoding as Board::setNumber: hidden Empty/Number with 0-8 mines, or a hidden Mine
+    std::array<Cell, 10> makeGeneratedCells()
+    {
+        std::array<Cell, 10> generated{
+            Cell(CellContent::Empty), Cell(CellContent::Number), Cell(CellContent::Number),
+            Cell(CellContent::Number), Cell(CellContent::Number), Cell(CellContent::Number),
+            Cell(CellContent::Number), Cell(CellContent::Number), Cell(CellContent::Number),
+            Cell(CellContent::Mine)};
+        for (int n = 0; n <= 8; ++n)
+            generated[n].setNearbyMines(n);
+        return generated;
+    }
+
+    const std::array<Cell, 10> GeneratedCells = makeGeneratedCells();
+}
+
+// Constructor - nothing is generated until a cell is accessed
+ChunkedBoard::ChunkedBoard(int minesPerChunk, std::uint64_t seed)
+    : minesPerChunk(std::clamp(minesPerChunk, 0, Size * Size)), seed(seed)
+{
+}
+
+// * Chunk management
+std::uint64_t ChunkedBoard::keyOf(std::int64_t chunkColumn, std::int64_t chunkRow)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(chunkColumn)) << 32) |
+           static_cast<std::uint32_t>(chunkRow);
+}
+
+ChunkedBoard::Chunk &ChunkedBoard::mineChunk(std::int64_t chunkColumn, std::int64_t chunkRow)
+{
+    const std::uint64_t key = keyOf(chunkColumn, chunkRow);
+    auto [it, inserted] = chunks.try_emplace(key);
+
+    if (inserted)
+    {
+        // Derive the chunk's own engine from (seed, chunk coordinates) so generation order never matters
+        SplitMix64 hash(seed ^ (key * 0x9E3779B97F4A7C15ull));
+        SplitMix64 rng(hash() ^ hash());
+
+        it->second = std::make_unique<Chunk>();
+        it->second->mines.scatter(minesPerChunk, rng);
+    }
+
+    return *it->second;
+}
+
+ChunkedBoard::Chunk &ChunkedBoard::numberedChunk(std::int64_t chunkColumn, std::int64_t chunkRow)
+{
+    const std::uint64_t key = keyOf(chunkColumn, chunkRow);
+    if (cachedChunk && cachedKey == key)
+        return *cachedChunk;
+
+    Chunk &chunk = mineChunk(chunkColumn, chunkRow);
+    if (chunk.cells.empty())
+        setNumber(chunkColumn, chunkRow, chunk);
+
+    cachedKey = key;
+    cachedChunk = &chunk;
+    return chunk;
+}
+
+void ChunkedBoard::setNumber(std::int64_t chunkColumn, std::int64_t chunkRow, Chunk &chunk)
+{
+    // The 3x3 block of chunks around this one; only their mines are generated
+    std::array<const MineLayer *, 9> around{};
+    for (int dr = -1; dr <= 1; ++dr)
+        for (int dc = -1; dc <= 1; ++dc)
+            around[(dr + 1) * 3 + dc + 1] = &mineChunk(chunkColumn + dc, chunkRow + dr).mines;
+
+    // Padded rows hold the real neighbour bits (left/right chunk edges) instead of zeros
+    auto expand = [&around](int row, std::uint8_t *out) {
+        const int band = row < 0 ? 0 : (row >= Size ? 2 : 1);
+        const int localRow = (row + Size) % Size;
+        out[0] = around[band * 3 + 0]->test(Size - 1, localRow);
+        around[band * 3 + 1]->expandRow(localRow, out + 1);
+        out[Size + 1] = around[band * 3 + 2]->test(0, localRow);
+    };
+
+    std::array<std::uint8_t, Padded * 5> scratch{};
+    std::array<std::uint8_t *, 3> window{scratch.data(), scratch.data() + Padded, scratch.data() + 2 * Padded};
+    std::uint8_t *columnSums = scratch.data() + 3 * Padded;
+    std::uint8_t *counts = scratch.data() + 4 * Padded;
+
+    chunk.cells.assign(static_cast<std::size_t>(Size) * Size, Cell(CellContent::Empty));
+    expand(-1, window[0]);
+    expand(0, window[1]);
+
+    for (int r = 0; r < Size; ++r)
+    {
+        expand(r + 1, window[2]);
+        MineLayer::countNeighbours(window[0], window[1], window[2], columnSums, counts, Size);
+
+        Cell *line = &chunk.cells[static_cast<std::size_t>(r) * Size];
+        const std::uint8_t *isMine = window[1] + 1;
+        for (int c = 0; c < Size; ++c)
+            line[c] = GeneratedCells[isMine[c] ? 9 : counts[c]];
+
+        std::ranges::rotate(window, window.begin() + 1);
+    }
+}
+
+Cell &ChunkedBoard::cellAt(std::int64_t column, std::int64_t row)
+{
+    Chunk &chunk = numberedChunk(chunkOf(column), chunkOf(row));
+    return chunk.cells[static_cast<std::size_t>(row & (Size - 1)) * Size + static_cast<std::size_t>(column & (Size - 1))];
+}
+
+// * Getters
+Cell ChunkedBoard::getCell(std::int64_t column, std::int64_t row) { return cellAt(column, row); }
+
+bool ChunkedBoard::isMine(std::int64_t column, std::int64_t row)
+{
+    return mineChunk(chunkOf(column), chunkOf(row)).mines.test(static_cast<int>(column & (Size - 1)),
+                                                               static_cast<int>(row & (Size - 1)));
+}
+
+// * Interaction
+int ChunkedBoard::reveal(std::int64_t column, std::int64_t row, int limit)
+{
+    Cell &cell = cellAt(column, row);
+    if (lost || !cell.isHidden())
+        return 0;
+
+    cell.setState(CellState::Revealed);
+    ++revealedCells;
+
+    if (cell.isMine())
+    {
+        lost = true;
+        revealQueue.clear();
+        return 1;
+    }
+
+    if (cell.isEmpty())
+    {
+        revealQueue.push_back(column);
+        revealQueue.push_back(row);
+    }
+
+    return 1 + resumeReveal(limit - 1);
+}
+
+int ChunkedBoard::resumeReveal(int limit)
+{
+    int revealed = 0;
+
+    // Same worklist fill as Game::revealCellAndPropagate, but stopping once the limit is reached
+    while (!revealQueue.empty() && revealed < limit)
+    {
+        const std::int64_t row = revealQueue.back();
+        revealQueue.pop_back();
+        const std::int64_t column = revealQueue.back();
+        revealQueue.pop_back();
+
+        for (std::int64_t r = row - 1; r <= row + 1; ++r)
+        {
+            for (std::int64_t c = column - 1; c <= column + 1; ++c)
+            {
+                Cell &neighbor = cellAt(c, r);
+                if (!neighbor.isHidden())
+                    continue;
+
+                neighbor.setState(CellState::Revealed);
+                ++revealedCells;
+                ++revealed;
+
+                if (neighbor.isEmpty())
+                {
+                    revealQueue.push_back(c);
+                    revealQueue.push_back(r);
+                }
+            }
+        }
+    }
+
+    return revealed;
+}
+
+int ChunkedBoard::chord(std::int64_t column, std::int64_t row, int limit)
+{
+    const Cell cell = cellAt(column, row);
+    if (lost || !cell.isRevealed() || cell.getNearbyMines() == 0)
+        return 0;
+
+    int flags = 0;
+    for (std::int64_t r = row - 1; r <= row + 1; ++r)
+        for (std::int64_t c = column - 1; c <= column + 1; ++c)
+            flags += cellAt(c, r).isFlagged();
+    if (flags != cell.getNearbyMines())
+        return 0;
+
+    int revealed = 0;
+    for (std::int64_t r = row - 1; r <= row + 1; ++r)
+        for (std::int64_t c = column - 1; c <= column + 1; ++c)
+            revealed += reveal(c, r, limit - revealed);
+    return revealed;
+}
+
+bool ChunkedBoard::toggleFlag(std::int64_t column, std::int64_t row)
+{
+    Cell &cell = cellAt(column, row);
+    if (cell.isRevealed())
+        return false;
+
+    cell.toggleFlag();
+    flaggedCells += cell.isFlagged() ? 1 : -1;
+    return true;
+}
@@ -6,69 +6,267 @@
  */
 
 #include "Game.h"
+#include "Coordinates.h"
 #include "enums/Color.h"
 #include "Message.h"
-
+#include "MoveParser.h"
+#include "ReplayWriter.h"
+#include "TerminalScreen.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <limits>
 #include <iostream>
-#include <regex>
+#include <stdexcept>
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten/emscripten.h>
 #endif
 
+namespace {
+    /**
+     * @brief Per cell byte of a save (packed as documented in Cell.h): 16-bit lanes counting
+     *        revealed safe cells, flags, hidden cells and invalid bytes, so a row of up to 64
+     *        cells is tallied with one addition per cell
+     */
+    constexpr std::array<std::uint64_t, 256> CellTallies = [] {
+        std::array<std::uint64_t, 256> tallies{};
+        for (int bits = 0; bits < 256; ++bits) {
+            const int nearby = bits & 0x0F;
+            const int state = (bits >> 4) & 0x03;
+            const int content = bits >> 6;
+            const bool mine = content == 2;
+
+            // Empty cells count nothing and numbers 1 to 8 (mines keep whatever count they were given)
+            const bool invalid = nearby > 8 || state > 2 || content > 2 || (content == 0 && nearby != 0) ||
+                                 (content == 1 && nearby == 0);
+            tallies[bits] = std::uint64_t{state == 1 && !mine} | std::uint64_t{state == 2} << 16 |
+                            std::uint64_t{state == 0} << 32 | std::uint64_t{invalid} << 48;
+        }
+        return tallies;
+    }();
+
+    /**
+     * @brief Checks the cells and mine words of a save against each other and its header
+     *
+     * One pass over the bytes as they are, before anything is built from them: every
+     * cell must be a valid packed Cell, the bit-plane must hold exactly the mine cells,
+     * and the header's mine count and O(1) counters must match the cells. The pass has
+     * no data-dependent branches.
+     */
+    void validateCells(const SaveFormat::Header &header, std::span<const std::uint8_t> save) {
+        const std::uint8_t *cells = save.data() + sizeof(SaveFormat::Header);
+        const std::uint8_t *words = save.data() + SaveFormat::layerOffset(header);
+        std::int64_t mines = 0, revealedSafe = 0, flagged = 0, hidden = 0;
+        std::uint64_t invalid = 0;
+
+        for (int r = 0; r < header.rows; ++r) {
+            const std::uint8_t *line = cells + static_cast<std::size_t>(r) * header.columns;
+            for (int w = 0; w < header.wordsPerRow; ++w) {
+                std::uint64_t word;
+                std::memcpy(&word, words + (static_cast<std::size_t>(r) * header.wordsPerRow + w) * sizeof(word),
+                            sizeof(word));
+
+                // Bits past the last column must be clear (the neighbour kernels read whole words)
+                const int first = w * 64;
+                const int count = std::min(64, header.columns - first);
+                if (count < 64)
+                    invalid |= word >> count;
+
+                std::uint64_t tally = 0, cellMines = 0;
+                for (int i = 0; i < count; ++i) {
+                    const std::uint8_t bits = line[first + i];
+                    tally += CellTallies[bits];
+                    cellMines |= std::uint64_t{(bits >> 6) == 2} << i;
+                }
+                invalid |= (cellMines ^ word) | (tally >> 48);
+                revealedSafe += tally & 0xFFFF;
+                flagged += (tally >> 16) & 0xFFFF;
+                hidden += (tally >> 32) & 0xFFFF;
+                mines += std::popcount(word);
+            }
+        }
+
+        if (invalid)
+            throw std::runtime_error("invalid cells or mine layer in save");
+        if (mines != header.mines || revealedSafe != header.revealedSafe || flagged != header.flagged ||
+            hidden != header.hidden)
+            throw std::runtime_error("counters in save do not match its cells");
+    }
+}
+
 // Constructor - initializes game itself with board dimensions and mine count
-Game::Game(int columns, int rows, int mines) : board(columns, rows, mines) {
+Game::Game(int columns, int rows, int mines, std::uint64_t seed) : board(columns, rows, mines, seed) {
+    // Enough for typical openings; the worklist keeps any growth for later moves
+    revealQueue.reserve(std::min<std::size_t>(board.getBoard().size(), 4096));
+}
+
+Game::Game(int columns, int rows, int mines, std::uint64_t seed, int startColumn, int startRow)
+    : board(columns, rows, mines, seed, startColumn, startRow) {
+    revealQueue.reserve(std::min<std::size_t>(board.getBoard().size(), 4096));
+}
+
+// Restores from a checked save; the clock is set back so that the saved time has already passed
+Game::Game(const SaveFormat::Header &header, std::span<const std::uint8_t> save)
+    : board(header, save), state(static_cast<GameState>(header.state)), moves(header.moves),
+      historyEnabled(header.flags & SaveFormat::FlagHistory) {
+    revealQueue.reserve(std::min<std::size_t>(board.getBoard().size(), 4096));
+
+    if (moves > 0) {
+        startTime = std::chrono::steady_clock::now() - std::chrono::milliseconds(header.elapsedMs);
+        if (!isPlaying())
+            endTime = startTime + std::chrono::milliseconds(header.elapsedMs);
+    }
+}
+
+void Game::reset(std::uint64_t seed) {
+    board.reset(seed);
+    state = GameState::Playing;
+    changes.clear();
+    journal.clear();
+    moves = 0;
+    startTime = endTime = {};
+}
+
+void Game::reset(std::uint64_t seed, int startColumn, int startRow) {
+    board.reset(seed, startColumn, startRow);
+    state = GameState::Playing;
+    changes.clear();
+    journal.clear();
+    moves = 0;
+    startTime = endTime = {};
+}
+
+void Game::reset(const MineLayer &layout) {
+    board.reset(layout);
+    state = GameState::Playing;
+    changes.clear();
+    journal.clear();
+    moves = 0;
+    startTime = endTime = {};
+}
+
+// * Persistence
+std::vector<std::uint8_t> Game::save() const {
+    SaveFormat::Header header;
+    header.flags = historyEnabled ? SaveFormat::FlagHistory : 0;
+    header.state = getStateValue();
+    header.moves = moves;
+    header.elapsedMs = static_cast<std::int32_t>(
+            std::min<std::int64_t>(getElapsedMilliseconds(), std::numeric_limits<std::int32_t>::max()));
+    header.columns = board.getColumns();
+    header.rows = board.getRows();
+    header.wordsPerRow = static_cast<std::int32_t>(board.getMineLayer().getWordsPerRow());
+
+    std::vector<std::uint8_t> bytes(SaveFormat::fileSize(header));
+    board.saveTo(header, bytes);
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    return bytes;
+}
+
+Game Game::load(std::span<const std::uint8_t> save) {
+    SaveFormat::Header header;
+    if (save.size() < sizeof(header))
+        throw std::runtime_error("not a save file");
+    std::memcpy(&header, save.data(), sizeof(header));
+
+    if (header.magic != SaveFormat::Magic)
+        throw std::runtime_error("not a save file");
+    if (header.version != SaveFormat::Version)
+        throw std::runtime_error("unsupported save version " + std::to_string(header.version));
+
+    const std::int64_t cells = static_cast<std::int64_t>(header.columns) * header.rows;
+    if (header.columns <= 0 || header.rows <= 0 || cells > std::numeric_limits<std::int32_t>::max() ||
+        header.wordsPerRow != (header.columns + 63) / 64)
+        throw std::runtime_error("invalid board size in save");
+    if (save.size() != SaveFormat::fileSize(header))
+        throw std::runtime_error("save has the wrong size for its board");
+    if (header.mines < 0 || header.mines > cells || header.revealedSafe < 0 || header.flagged < 0 ||
+        header.hidden < 0 || std::int64_t{header.revealedSafe} + header.flagged + header.hidden > cells ||
+        header.state < 0 || header.state > 2 || header.moves < 0 || header.elapsedMs < 0)
+        throw std::runtime_error("invalid counters in save");
+    validateCells(header, save);
+
+    return Game(header, save);
 }
 
 // Main game loop - handles input, validation, and game flow
-void Game::start() {
+void Game::start(bool keepOnExit) {
+#if defined(__EMSCRIPTEN__)
     clear();
 
     while (isPlaying()) {
-        board.print();
+        print();
 
         std::string input = prompt();
 
         // If EOF/cancel occurred in the prompt (in web), end the game
         if (!std::cin.good()) {
-            setLost();
+            if (!keepOnExit)
+                setLost();
             break;
         }
 
-        if (!isValidInput(input)) {
+        if (!playLine(input)) {
             clear();
             Message::warn("Invalid format!");
             continue;
         }
 
-        auto [column, row, action] = parseInput(input);
-        play(column, row, action);
-        checkWinCondition();
         clear();
     }
+#else
+    // Alternate screen with differential redraws: each move only rewrites the cells it changed
+    TerminalScreen screen;
+    screen.show(board);
+
+    while (isPlaying()) {
+        std::string input = prompt();
+
+        if (!std::cin.good()) {
+            if (!keepOnExit)
+                setLost();
+            break;
+        }
+
+        if (!isValidInput(input)) {
+            screen.update(board, {});
+            Message::warn("Invalid format!");
+            continue;
+        }
+
+        // Several moves may share a line; each one redraws what it changed
+        std::string_view moves = input;
+        InputData move{};
+        while (isPlaying() && MoveParser::next(moves, move) == MoveParser::Result::Move) {
+            play(move.column, move.row, move.action);
+            checkWinCondition();
+            screen.update(board, changes);
+        }
+    }
+
+    // The final board stays on the normal screen after the game
+    screen.close();
+#endif
 
-    board.print();
+    print();
 
-    Message::warn(isLost() ? "You lost the game!" : "You won the game!");
+    Message::warn(isLost() ? "You lost the game!" : isWon() ? "You won the game!" : "Game stopped.");
+
+    const std::int64_t elapsed = getElapsedMilliseconds();
+    std::cout << "Moves: " << moves << "  Time: " << elapsed / 1000 << '.' << elapsed / 100 % 10
+            << "s  3BV: " << board.getThreeBV() << "\n";
 
 #if !defined(__EMSCRIPTEN__)
     std::cin.get();
 #endif
 }
 
-// Win condition check - counts revealed non-mine cells
+// Win condition check - compares the board's running counter of revealed non-mine cells
 void Game::checkWinCondition() {
-    int cellsWithoutMine = board.getColumns() * board.getRows() - board.getMines();
-    int revealedCellsWithoutMine = 0;
-
-    for (std::vector<Cell> &row: board.getBoard()) {
-        for (Cell &cell: row) {
-            if (!cell.isMine() && cell.isRevealed())
-                ++revealedCellsWithoutMine;
-        }
-    }
-
-    if (cellsWithoutMine == revealedCellsWithoutMine)
+    if (isPlaying() && board.getRevealedSafeCount() == board.getSafeCellCount())
         setWon();
 }
 
@@ -78,15 +276,17 @@ std::string Game::prompt() {
     std::cout << "+--------------------------------------------------------------+\n";
     std::cout << "| Choose a column (" << Color::Yellow << "A" << Color::Reset << "), a row (" << Color::Yellow << "1"
             << Color::Reset << ") and your action (" << Color::Red << "F" << Color::Reset << ", " << Color::Teal << "R"
-            << Color::Reset << ")        |\n";
+            << Color::Reset << ", " << Color::Yellow << "C" << Color::Reset << ")     |\n";
     std::cout << "| - " << Color::Red << "F" << Color::Reset << " stands for " << Color::Red << "Flag" << Color::Reset
             << " and is used to mark a cell with a flag   |\n";
     std::cout << "| - " << Color::Teal << "R" << Color::Reset << " stands for " << Color::Teal << "Reveal" <<
             Color::Reset << " and is used to uncover a cell          |\n";
+    std::cout << "| - " << Color::Yellow << "C" << Color::Reset << " stands for " << Color::Yellow << "Chord" <<
+            Color::Reset << " and reveals around a flagged number     |\n";
     std::cout << "| - If you want to reveal, you can omit the " << Color::Teal << "R" << Color::Reset <<
             "                  |\n";
     std::cout << "|                                                              |\n";
-    std::cout << "| Valid input examples: (A9 F), (B3 R), (C4) etc.              |\n";
+    std::cout << "| Examples: (A9 F), (B3), (C4 C), several moves: (A1 B2F 3,4)  |\n";
     std::cout << "+--------------------------------------------------------------+\n";
 
     std::string input;
@@ -100,54 +300,316 @@ std::string Game::prompt() {
     return input;
 }
 
-// Process player move - handles flag/reveal actions
+// Process player move - the change list restarts with every call
 void Game::play(int column, int row, char action) {
+    changes.clear();
+    applyMove(column, row, action);
+}
+
+// Apply one move, appending what it changed to the change list and, if enabled, the journal
+void Game::applyMove(int column, int row, char action) {
+    const std::size_t first = changes.size();
+    dispatchMove(column, row, action);
+
+    if (recorder)
+        recorder->append({column, row, action});
+
+    if (!historyEnabled || changes.size() == first)
+        return;
+
+    journal.record({column, row, action}, std::span(changes).subspan(first));
+    if (journal.wantsSnapshot(board.getBoard().size())) {
+        std::vector<std::uint8_t> packed;
+        board.packVisibleState(packed);
+        journal.addSnapshot(std::move(packed));
+    }
+}
+
+void Game::dispatchMove(int column, int row, char action) {
     Cell &cell = board.getCell(column, row);
 
+    // The clock starts with the first move, like the classic game
+    if (moves++ == 0)
+        startTime = std::chrono::steady_clock::now();
+
     if (action == 'F') {
-        if (!cell.isRevealed()) {
-            cell.toggleFlag();
-        }
+        const std::size_t index = board.index(column, row);
+        if (board.toggleFlag(index))
+            changes.push_back({static_cast<std::uint32_t>(index),
+                               cell.isFlagged() ? ChangeReason::Flagged : ChangeReason::Unflagged});
+        return;
+    }
+
+    if (action == 'C') {
+        chord(column, row);
         return;
     }
 
     revealCellAndPropagate(column, row);
 
-    if (cell.isMine()) {
+    // A flagged mine is protected by its flag and does not explode
+    if (cell.isMine() && cell.isRevealed()) {
         setLost();
         return;
     }
 }
 
+// Batch execution - applies moves until the game ends, recording one outcome per move
+std::size_t Game::playBatch(std::span<const InputData> moves, std::span<MoveOutcome> outcomes) {
+    std::size_t played = 0;
+    changes.clear();
+
+    for (; played < moves.size() && isPlaying(); ++played) {
+        const auto [column, row, action] = moves[played];
+        MoveOutcome outcome = MoveOutcome::Invalid;
+
+        if (board.isValidBoardCoordinate(column, row) && (action == 'R' || action == 'F' || action == 'C')) {
+            const std::size_t before = changes.size();
+            applyMove(column, row, action);
+            checkWinCondition();
+
+            if (isLost())
+                outcome = MoveOutcome::Exploded;
+            else if (changes.size() == before)
+                outcome = MoveOutcome::None;
+            else if (changes.back().reason == ChangeReason::Flagged)
+                outcome = MoveOutcome::Flagged;
+            else if (changes.back().reason == ChangeReason::Unflagged)
+                outcome = MoveOutcome::Unflagged;
+            else
+                outcome = MoveOutcome::Revealed;
+        }
+
+        if (played < outcomes.size())
+            outcomes[played] = outcome;
+    }
+
+    for (std::size_t i = played; i < std::min(moves.size(), outcomes.size()); ++i)
+        outcomes[i] = MoveOutcome::Skipped;
+
+    return played;
+}
+
+// * History - every step walks one entry's change records
+void Game::enableHistory(bool enabled) {
+    historyEnabled = enabled;
+    journal.clear();
+}
+
+void Game::stepBack() {
+    const std::size_t entry = journal.getPosition() - 1;
+    const std::span<const CellChange> records = journal.changesOf(entry);
+
+    for (auto it = records.rbegin(); it != records.rend(); ++it) {
+        switch (it->reason) {
+        case ChangeReason::Revealed:
+        case ChangeReason::Exploded:
+            board.hideCell(it->index);
+            changes.push_back({it->index, ChangeReason::Hidden});
+            break;
+        case ChangeReason::Flagged:
+        case ChangeReason::Unflagged:
+            board.toggleFlag(it->index);
+            changes.push_back({it->index, it->reason == ChangeReason::Flagged ? ChangeReason::Unflagged
+                                                                               : ChangeReason::Flagged});
+            break;
+        case ChangeReason::Hidden:
+            break;
+        }
+    }
+
+    journal.setPosition(entry);
+}
+
+void Game::stepForward() {
+    const std::size_t entry = journal.getPosition();
+
+    for (const CellChange &change : journal.changesOf(entry)) {
+        if (change.reason == ChangeReason::Revealed || change.reason == ChangeReason::Exploded)
+            board.revealCell(change.index);
+        else if (change.reason != ChangeReason::Hidden)
+            board.toggleFlag(change.index);
+        changes.push_back(change);
+    }
+
+    journal.setPosition(entry + 1);
+}
+
+// Bring one cell to a packed state code (0 hidden, 1 revealed, 2 flagged) through the counted primitives
+void Game::setCellCode(std::size_t index, int code) {
+    const Cell cell = board.getCell(index);
+    const int current = cell.isRevealed() ? 1 : cell.isFlagged() ? 2 : 0;
+    if (current == code)
+        return;
+
+    if (current == 1)
+        board.hideCell(index);
+    else if (current == 2)
+        board.toggleFlag(index);
+
+    const auto offset = static_cast<std::uint32_t>(index);
+    if (code == 1) {
+        board.revealCell(index);
+        changes.push_back({offset, cell.isMine() ? ChangeReason::Exploded : ChangeReason::Revealed});
+    } else if (code == 2) {
+        board.toggleFlag(index);
+        changes.push_back({offset, ChangeReason::Flagged});
+    } else {
+        changes.push_back({offset, current == 1 ? ChangeReason::Hidden : ChangeReason::Unflagged});
+    }
+}
+
+// The state follows from the counters: a revealed mine loses, all safe cells revealed wins
+void Game::syncState() {
+    const GameState previous = state;
+
+    if (board.getRevealedMineCount() > 0)
+        state = GameState::Lost;
+    else if (board.getRevealedSafeCount() == board.getSafeCellCount())
+        state = GameState::Won;
+    else
+        state = GameState::Playing;
+
+    if (previous == GameState::Playing && state != GameState::Playing)
+        endTime = std::chrono::steady_clock::now();
+}
+
+bool Game::undo() {
+    if (journal.getPosition() == 0)
+        return false;
+
+    changes.clear();
+    stepBack();
+    syncState();
+    if (recorder)
+        recorder->append({0, 0, 'U'});
+    return true;
+}
+
+bool Game::redo() {
+    if (journal.getPosition() == journal.size())
+        return false;
+
+    changes.clear();
+    stepForward();
+    syncState();
+    if (recorder)
+        recorder->append({0, 0, 'Y'});
+    return true;
+}
+
+void Game::rewindTo(std::size_t position) {
+    position = std::min(position, journal.size());
+    const std::size_t from = journal.getPosition();
+    changes.clear();
+
+    // Restoring a snapshot touches every cell once, about cells / 4 records' worth of work
+    const std::size_t cells = board.getBoard().size();
+    const MoveJournal::Snapshot *snapshot = journal.snapshotBefore(position);
+    if (snapshot && cells / 4 + journal.changesBetween(snapshot->position, position) <
+                    journal.changesBetween(journal.getPosition(), position)) {
+        for (std::size_t i = 0; i < cells; ++i)
+            setCellCode(i, snapshot->cells[i / 4] >> (2 * (i % 4)) & 3);
+        journal.setPosition(snapshot->position);
+    }
+
+    while (journal.getPosition() > position)
+        stepBack();
+    while (journal.getPosition() < position)
+        stepForward();
+
+    syncState();
+
+    // A replay has no jumps: the rewind is stored as the equivalent undo / redo steps
+    if (recorder)
+        for (std::size_t step = std::min(from, position); step < std::max(from, position); ++step)
+            recorder->append({0, 0, from > position ? 'U' : 'Y'});
+}
+
+// Chord - reveals around a number once as many neighbours are flagged
+int Game::chord(int column, int row) {
+    const Cell cell = board.getCell(column, row);
+    if (!cell.isRevealed() || cell.getNearbyMines() == 0)
+        return 0;
+
+    const int firstColumn = std::max(0, column - 1), lastColumn = std::min(board.getColumns() - 1, column + 1);
+    const int firstRow = std::max(0, row - 1), lastRow = std::min(board.getRows() - 1, row + 1);
+
+    int flags = 0;
+    for (int r = firstRow; r <= lastRow; ++r)
+        for (int c = firstColumn; c <= lastColumn; ++c)
+            flags += board.getCell(c, r).isFlagged();
+
+    if (flags != cell.getNearbyMines())
+        return 0;
+
+    int revealed = 0;
+    for (int r = firstRow; r <= lastRow; ++r) {
+        for (int c = firstColumn; c <= lastColumn; ++c) {
+            if (!board.getCell(c, r).isHidden())
+                continue;
+
+            revealed += revealCellAndPropagate(c, r);
+            if (board.getCell(c, r).isMine())
+                setLost();
+        }
+    }
+
+    return revealed;
+}
+
 // Flood-fill algorithm - reveals cells and propagates to empty neighbors
-void Game::revealCellAndPropagate(int column, int row) {
+int Game::revealCellAndPropagate(int column, int row) {
     if (!board.isValidBoardCoordinate(column, row))
-        return;
+        return 0;
 
-    Cell &cell = board.getCell(column, row);
+    const std::size_t start = board.index(column, row);
 
-    if (cell.isRevealed() || cell.isFlagged())
-        return;
+    if (!board.revealCell(start))
+        return 0;
 
-    cell.setState(CellState::Revealed);
+    int revealed = 1;
+    changes.push_back({static_cast<std::uint32_t>(start),
+                       board.getCell(start).isMine() ? ChangeReason::Exploded : ChangeReason::Revealed});
 
-    if (cell.isEmpty()) {
-        for (int r = -1; r <= 1; ++r) {
-            for (int c = -1; c <= 1; ++c) {
-                if (!board.isValidBoardCoordinate(column + c, row + r))
-                    continue;
+    if (!board.getCell(start).isEmpty())
+        return revealed;
+
+    const int columns = board.getColumns();
+    const int rows = board.getRows();
+
+    revealQueue.clear();
+    revealQueue.push_back(static_cast<std::uint32_t>(start));
+
+    while (!revealQueue.empty()) {
+        const std::uint32_t current = revealQueue.back();
+        revealQueue.pop_back();
 
-                if (c == 0 && r == 0)
+        const int c = static_cast<int>(current % columns);
+        const int r = static_cast<int>(current / columns);
+        const int firstColumn = c > 0 ? c - 1 : 0;
+        const int lastColumn = c < columns - 1 ? c + 1 : c;
+        const int firstRow = r > 0 ? r - 1 : 0;
+        const int lastRow = r < rows - 1 ? r + 1 : r;
+
+        for (int nr = firstRow; nr <= lastRow; ++nr) {
+            for (int nc = firstColumn; nc <= lastColumn; ++nc) {
+                const std::size_t neighbor = board.index(nc, nr);
+
+                // Revealed (including the current cell) and flagged cells are skipped
+                if (!board.revealCell(neighbor))
                     continue;
 
-                Cell &neighborCell = board.getCell(column + c, row + r);
+                ++revealed;
+                changes.push_back({static_cast<std::uint32_t>(neighbor), ChangeReason::Revealed});
 
-                if (!neighborCell.isRevealed() && !neighborCell.isFlagged()) {
-                    revealCellAndPropagate(column + c, row + r);
-                }
+                if (board.getCell(neighbor).isEmpty())
+                    revealQueue.push_back(static_cast<std::uint32_t>(neighbor));
             }
         }
     }
+
+    return revealed;
 }
 
 // * Getters - simple state check methods
@@ -156,34 +618,52 @@ bool Game::isWon() const { return state == GameState::Won; }
 bool Game::isLost() const { return state == GameState::Lost; }
 
 // * Setters - direct state assignment
-void Game::setWon() { state = GameState::Won; }
-void Game::setLost() { state = GameState::Lost; }
+void Game::setWon() {
+    state = GameState::Won;
+    endTime = std::chrono::steady_clock::now();
+}
+
+void Game::setLost() {
+    state = GameState::Lost;
+    endTime = std::chrono::steady_clock::now();
+}
 
 // * Utils - utility methods for game operations
-void Game::print() const { board.print(); }
+void Game::print() const { renderer.draw(board); }
+
+// Input validation - every move of the line must parse and lie inside the board
+bool Game::isValidInput(std::string_view input) const {
+    InputData move{};
+    MoveParser::Result result;
+    int count = 0;
+
+    while ((result = MoveParser::next(input, move)) == MoveParser::Result::Move) {
+        if (!board.isValidBoardCoordinate(move.column, move.row))
+            return false;
+        ++count;
+    }
 
-// Input validation using regex pattern matching
-bool Game::isValidInput(const std::string &input) const {
-    std::regex promptValidation(R"(([A-Z])(1?[0-9]|2[0-6])(\s([FR]))?)");
-    return std::regex_match(input, promptValidation);
+    return result == MoveParser::Result::End && count > 0;
 }
 
-// Parse user input into structured data (column, row, action)
-InputData Game::parseInput(const std::string &input) const {
-    int playedColumn = static_cast<int>(input.at(0)) - 65;
-    std::string::size_type spacePos = input.find(' ');
-    int playedRow;
-    char action;
+// Parse the first move of the line into structured data (column, row, action)
+InputData Game::parseInput(std::string_view input) const {
+    InputData move{-1, -1, 'R'};
+    MoveParser::next(input, move);
+    return move;
+}
 
-    if (spacePos == std::string::npos) {
-        playedRow = std::stoi(input.substr(1)) - 1;
-        action = 'R';
-    } else {
-        playedRow = std::stoi(input.substr(1, spacePos - 1)) - 1;
-        action = input.at(input.length() - 1);
-    }
+bool Game::playLine(std::string_view input) {
+    if (!isValidInput(input))
+        return false;
 
-    return {playedColumn, playedRow, action};
+    changes.clear();
+    InputData move{};
+    while (isPlaying() && MoveParser::next(input, move) == MoveParser::Result::Move) {
+        applyMove(move.column, move.row, move.action);
+        checkWinCondition();
+    }
+    return true;
 }
 
 // Cross-platform screen clearing
@@ -198,20 +678,32 @@ void Game::clear() {
 #endif
 }
 
-int Game::getFlagsCount() const {
-    int flags = 0;
-    for (const auto &row: board.getBoard())
-        for (const auto &cell: row)
-            if (cell.isFlagged())
-                ++flags;
-    return flags;
+int Game::getFlagsCount() const { return board.getFlagCount(); }
+
+int Game::getRevealedCount() const { return board.getRevealedSafeCount(); }
+
+std::int64_t Game::getElapsedMilliseconds() const {
+    if (moves == 0)
+        return 0;
+
+    const auto end = isPlaying() ? std::chrono::steady_clock::now() : endTime;
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - startTime).count();
 }
 
-int Game::getRevealedCount() const {
-    int revealed = 0;
-    for (const auto &row: board.getBoard())
-        for (const auto &cell: row)
-            if (cell.isRevealed() && !cell.isMine())
-                ++revealed;
-    return revealed;
+GameStatus Game::getStatus() const {
+    GameStatus status;
+    status.columns = board.getColumns();
+    status.rows = board.getRows();
+    status.mines = board.getMines();
+    status.flags = board.getFlagCount();
+    status.revealed = board.getRevealedSafeCount();
+    status.state = getStateValue();
+    status.moves = moves;
+    status.elapsedMs = static_cast<std::int32_t>(
+            std::min<std::int64_t>(getElapsedMilliseconds(), std::numeric_limits<std::int32_t>::max()));
+    status.lastRevealed = static_cast<std::int32_t>(std::ranges::count_if(changes, [](const CellChange &change) {
+        return change.reason == ChangeReason::Revealed || change.reason == ChangeReason::Exploded;
+    }));
+    status.threeBV = board.getThreeBV();
+    return status;
 }
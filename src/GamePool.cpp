@@ -0,0 +1,116 @@
+/**
+ * @file GamePool.cpp
+ * @brief Implementation of the game recycling pool
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "GamePool.h"
+
+#include <utility>
+
+void GamePool::Releaser::operator()(Game *game) const
+{
+    if (pool)
+        pool->release(game);
+    else
+        delete game;
+}
+
+// Constructor - nothing is allocated until the first game comes back
+GamePool::GamePool(std::size_t maxIdleCells) : maxIdleCells(maxIdleCells) {}
+
+// * Internals
+std::unique_ptr<Game> GamePool::take(const Shape &shape)
+{
+    std::scoped_lock guard(lock);
+    const auto bucket = idle.find(shape);
+    if (bucket == idle.end() || bucket->second.empty())
+    {
+        ++stats.created;
+        return nullptr;
+    }
+
+    std::unique_ptr<Game> game = std::move(bucket->second.back());
+    bucket->second.pop_back();
+    ++stats.reused;
+    --stats.idleGames;
+    stats.idleCells -= static_cast<std::size_t>(shape.columns) * shape.rows;
+    return game;
+}
+
+void GamePool::release(Game *game)
+{
+    std::unique_ptr<Game> owned(game);
+
+    // A recycled game starts like a new one: no history, no replay attached
+    owned->enableHistory(false);
+    owned->setRecorder(nullptr);
+
+    const Shape shape{owned->getColumns(), owned->getRows(), owned->getMinesTotal()};
+    const std::size_t cells = static_cast<std::size_t>(shape.columns) * shape.rows;
+    {
+        std::scoped_lock guard(lock);
+        if (stats.idleCells + cells <= maxIdleCells)
+        {
+            // Only the first game of a shape (or a new high of idle ones) grows the bucket
+            idle[shape].push_back(std::move(owned));
+            ++stats.released;
+            ++stats.idleGames;
+            stats.idleCells += cells;
+            return;
+        }
+        ++stats.discarded;
+    }
+    // owned is freed here, outside the lock
+}
+
+// * Interaction
+GamePool::Lease GamePool::acquire(int columns, int rows, int mines, std::uint64_t seed)
+{
+    // Buckets hold games by the mines they actually place (getMinesTotal() on release)
+    std::unique_ptr<Game> game = take({columns, rows, Board::minesFitting(columns, rows, mines)});
+    if (game)
+        game->reset(seed);
+    else
+        game = std::make_unique<Game>(columns, rows, mines, seed);
+    return Lease(game.release(), Releaser{this});
+}
+
+GamePool::Lease GamePool::acquire(int columns, int rows, int mines, std::uint64_t seed, int startColumn,
+                                  int startRow)
+{
+    std::unique_ptr<Game> game =
+        take({columns, rows, Board::minesFitting(columns, rows, mines, startColumn, startRow)});
+    if (game)
+        game->reset(seed, startColumn, startRow);
+    else
+        game = std::make_unique<Game>(columns, rows, mines, seed, startColumn, startRow);
+    return Lease(game.release(), Releaser{this});
+}
+
+GamePool::Lease GamePool::adopt(Game &&game)
+{
+    {
+        std::scoped_lock guard(lock);
+        ++stats.created;
+    }
+    return Lease(new Game(std::move(game)), Releaser{this});
+}
+
+void GamePool::trim()
+{
+    std::map<Shape, std::vector<std::unique_ptr<Game>>> freed;
+    {
+        std::scoped_lock guard(lock);
+        freed.swap(idle);
+        stats.idleGames = 0;
+        stats.idleCells = 0;
+    }
+}
+
+GamePool::Stats GamePool::getStats() const
+{
+    std::scoped_lock guard(lock);
+    return stats;
+}
@@ -0,0 +1,177 @@
+/**
+ * @file MineLayer.cpp
+ * @brief Implementation of the mine bit-plane and its neighbour counting kernel
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "MineLayer.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MINELAYER_SSE2 1
+#endif
+
+namespace
+{
+    // Every byte of mine bits expands into 8 bytes holding 0 or 1 (little-endian order)
+    constexpr std::array<std::uint64_t, 256> makeExpandTable()
+    {
+        std::array<std::uint64_t, 256> table{};
+        for (int value = 0; value < 256; ++value)
+            for (int bit = 0; bit < 8; ++bit)
+                if (value & (1 << bit))
+                    table[value] |= std::uint64_t{1} << (bit * 8);
+        return table;
+    }
+
+    constexpr std::array<std::uint64_t, 256> ExpandTable = makeExpandTable();
+}
+
+// Constructor - allocates a zeroed, word-padded bit-plane
+MineLayer::MineLayer(int columns, int rows)
+    : columns(columns), rows(rows), wordsPerRow((static_cast<std::size_t>(columns) + 63) / 64),
+      bits(wordsPerRow * rows, 0)
+{
+}
+
+// * Setters
+void MineLayer::setBytes(std::span<const std::byte> bytes)
+{
+    std::memcpy(bits.data(), bytes.data(), std::min(bytes.size(), bits.size() * sizeof(std::uint64_t)));
+}
+
+void MineLayer::clear() { std::ranges::fill(bits, 0); }
+
+void MineLayer::scatter(int count, SplitMix64 &rng)
+{
+    const auto cells = static_cast<std::uint32_t>(columns) * static_cast<std::uint32_t>(rows);
+
+    for (std::uint32_t j = cells - static_cast<std::uint32_t>(count); j < cells; ++j)
+    {
+        std::uint32_t target = rng.bounded(j + 1);
+        int column = static_cast<int>(target % columns);
+        int row = static_cast<int>(target / columns);
+
+        if (test(column, row))
+        {
+            column = static_cast<int>(j % columns);
+            row = static_cast<int>(j / columns);
+        }
+
+        set(column, row);
+    }
+}
+
+void MineLayer::scatter(int count, SplitMix64 &rng, std::span<const std::uint32_t> excluded)
+{
+    const auto allowed = static_cast<std::uint32_t>(columns) * static_cast<std::uint32_t>(rows) -
+                         static_cast<std::uint32_t>(excluded.size());
+
+    // Rank among the allowed cells -> row-major offset
+    const auto cellOf = [excluded](std::uint32_t rank)
+    {
+        for (const std::uint32_t skipped : excluded)
+        {
+            if (skipped > rank)
+                break;
+            ++rank;
+        }
+        return rank;
+    };
+
+    for (std::uint32_t j = allowed - static_cast<std::uint32_t>(count); j < allowed; ++j)
+    {
+        std::uint32_t target = cellOf(rng.bounded(j + 1));
+        if (test(static_cast<int>(target % columns), static_cast<int>(target / columns)))
+            target = cellOf(j);
+
+        set(static_cast<int>(target % columns), static_cast<int>(target / columns));
+    }
+}
+
+// * Utils
+void MineLayer::expandRow(int row, std::uint8_t *out) const
+{
+    if (row < 0 || row >= rows)
+    {
+        std::memset(out, 0, columns);
+        return;
+    }
+
+    const std::uint64_t *words = getRow(row);
+    int column = 0;
+
+    for (std::size_t w = 0; w < wordsPerRow; ++w)
+    {
+        std::uint64_t word = words[w];
+        for (int byte = 0; byte < 8 && column < columns; ++byte, word >>= 8)
+        {
+            const std::uint64_t expanded = ExpandTable[word & 0xFF];
+            const int count = std::min(8, columns - column);
+            std::memcpy(out + column, &expanded, count);
+            column += count;
+        }
+    }
+}
+
+void MineLayer::countNeighbours(const std::uint8_t *above, const std::uint8_t *current, const std::uint8_t *below,
+                                std::uint8_t *columnSums, std::uint8_t *out, int columns)
+{
+    const int padded = columns + 2;
+    int i = 0;
+
+    // Pass 1: vertical sums of the three rows (values 0-3)
+#if defined(__AVX2__)
+    for (; i + 32 <= padded; i += 32)
+    {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(above + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(current + i));
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(below + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(columnSums + i),
+                            _mm256_add_epi8(_mm256_add_epi8(a, b), c));
+    }
+#elif defined(MINELAYER_SSE2)
+    for (; i + 16 <= padded; i += 16)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(above + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(current + i));
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(below + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(columnSums + i), _mm_add_epi8(_mm_add_epi8(a, b), c));
+    }
+#endif
+    for (; i < padded; ++i)
+        columnSums[i] = static_cast<std::uint8_t>(above[i] + current[i] + below[i]);
+
+    // Pass 2: left + centre + right vertical sums, minus the cell itself (values 0-8)
+    i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= columns; i += 32)
+    {
+        const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(columnSums + i));
+        const __m256i centre = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(columnSums + i + 1));
+        const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(columnSums + i + 2));
+        const __m256i self = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(current + i + 1));
+        const __m256i sum = _mm256_sub_epi8(_mm256_add_epi8(_mm256_add_epi8(left, centre), right), self);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), sum);
+    }
+#elif defined(MINELAYER_SSE2)
+    for (; i + 16 <= columns; i += 16)
+    {
+        const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i *>(columnSums + i));
+        const __m128i centre = _mm_loadu_si128(reinterpret_cast<const __m128i *>(columnSums + i + 1));
+        const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i *>(columnSums + i + 2));
+        const __m128i self = _mm_loadu_si128(reinterpret_cast<const __m128i *>(current + i + 1));
+        const __m128i sum = _mm_sub_epi8(_mm_add_epi8(_mm_add_epi8(left, centre), right), self);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), sum);
+    }
+#endif
+    for (; i < columns; ++i)
+        out[i] = static_cast<std::uint8_t>(columnSums[i] + columnSums[i + 1] + columnSums[i + 2] - current[i + 1]);
+}
@@ -0,0 +1,72 @@
+/**
+ * @file MoveJournal.cpp
+ * @brief Implementation of the move journal behind undo and redo
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "MoveJournal.h"
+
+#include <algorithm>
+
+namespace
+{
+    // Small boards would otherwise snapshot after every few moves
+    constexpr std::size_t MinSnapshotSpacing = 1024;
+}
+
+void MoveJournal::clear()
+{
+    entries.clear();
+    log.clear();
+    snapshots.clear();
+    position = 0;
+}
+
+void MoveJournal::record(const InputData &move, std::span<const CellChange> changes)
+{
+    // A new move after undos replaces the undone branch
+    if (position < entries.size())
+    {
+        log.resize(entries[position].firstChange);
+        entries.resize(position);
+        while (!snapshots.empty() && snapshots.back().position > position)
+            snapshots.pop_back();
+    }
+
+    entries.push_back({move, static_cast<std::uint32_t>(log.size()), static_cast<std::uint32_t>(changes.size())});
+    log.insert(log.end(), changes.begin(), changes.end());
+    ++position;
+}
+
+bool MoveJournal::wantsSnapshot(std::size_t cells) const
+{
+    const std::size_t since = changesBetween(snapshots.empty() ? 0 : snapshots.back().position, position);
+    return since >= std::max(cells / 4, MinSnapshotSpacing);
+}
+
+void MoveJournal::addSnapshot(std::vector<std::uint8_t> &&cells)
+{
+    snapshots.push_back({position, std::move(cells)});
+}
+
+const MoveJournal::Snapshot *MoveJournal::snapshotBefore(std::size_t target) const
+{
+    const auto after = std::ranges::upper_bound(snapshots, target, {}, &Snapshot::position);
+    return after == snapshots.begin() ? nullptr : &*std::prev(after);
+}
+
+std::size_t MoveJournal::changesBetween(std::size_t from, std::size_t to) const
+{
+    // Entries are contiguous in the log, so a position maps to a log offset
+    const auto offset = [this](std::size_t at) {
+        return at < entries.size() ? std::size_t{entries[at].firstChange} : log.size();
+    };
+    const std::size_t a = offset(from), b = offset(to);
+    return a > b ? a - b : b - a;
+}
+
+std::span<const CellChange> MoveJournal::changesOf(std::size_t entry) const
+{
+    return std::span(log).subspan(entries[entry].firstChange, entries[entry].changeCount);
+}
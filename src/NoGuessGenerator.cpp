@@ -0,0 +1,106 @@
+/**
+ * @file NoGuessGenerator.cpp
+ * @brief Implementation of the parallel no-guess board search
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "NoGuessGenerator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Game.h"
+#include "Random.h"
+#include "Solver.h"
+
+NoGuessGenerator::NoGuessGenerator(int columns, int rows, int mines, int startColumn, int startRow)
+    : columns(columns), rows(rows), mines(mines), startColumn(startColumn), startRow(startRow)
+{
+}
+
+std::uint64_t NoGuessGenerator::candidateSeed(std::uint64_t baseSeed, std::uint64_t attempt)
+{
+    // SplitMix64 outputs are a mix of seed + n * gamma, so any attempt is reachable in O(1)
+    SplitMix64 rng(baseSeed + attempt * 0x9E3779B97F4A7C15ull);
+    return rng();
+}
+
+std::uint64_t NoGuessGenerator::defaultAttempts(int columns, int rows)
+{
+    const std::uint64_t cells = static_cast<std::uint64_t>(columns) * static_cast<std::uint64_t>(rows);
+    return std::clamp<std::uint64_t>((std::uint64_t{1} << 24) / std::max<std::uint64_t>(cells, 1), 8, 100000);
+}
+
+bool NoGuessGenerator::isSolvable(std::uint64_t seed) const
+{
+    Game game(columns, rows, mines, seed, startColumn, startRow);
+    Solver solver(game.getBoard());
+
+    int column = startColumn;
+    int row = startRow;
+    do
+    {
+        game.play(column, row, 'R');
+        game.checkWinCondition();
+        if (!game.isPlaying())
+            break;
+
+        solver.notifyRevealed(game.getChanges());
+        solver.solve();
+    } while (solver.nextSafeCell(column, row));
+
+    return game.isWon();
+}
+
+NoGuessGenerator::Result NoGuessGenerator::generate(std::uint64_t baseSeed, std::uint64_t maxAttempts,
+                                                    unsigned threads) const
+{
+#ifdef __EMSCRIPTEN__
+    // The web build has no thread support
+    threads = 1;
+#else
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+#endif
+
+    std::atomic<std::uint64_t> nextAttempt{0};
+    std::atomic<std::uint64_t> bestAttempt{maxAttempts};
+
+    // Every attempt below the final best was claimed and checked, so the result is the lowest success
+    const auto worker = [&]
+    {
+        for (;;)
+        {
+            const std::uint64_t attempt = nextAttempt.fetch_add(1, std::memory_order_relaxed);
+            if (attempt >= bestAttempt.load(std::memory_order_relaxed))
+                return;
+
+            if (!isSolvable(candidateSeed(baseSeed, attempt)))
+                continue;
+
+            std::uint64_t best = bestAttempt.load(std::memory_order_relaxed);
+            while (attempt < best && !bestAttempt.compare_exchange_weak(best, attempt, std::memory_order_relaxed))
+            {
+            }
+            return;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread &thread : pool)
+        thread.join();
+
+    Result result;
+    result.attempt = bestAttempt.load();
+    result.found = result.attempt < maxAttempts;
+    if (result.found)
+        result.seed = candidateSeed(baseSeed, result.attempt);
+    return result;
+}
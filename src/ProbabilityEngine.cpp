@@ -0,0 +1,658 @@
+/**
+ * @file ProbabilityEngine.cpp
+ * @brief Implementation of the exact frontier probability engine
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "ProbabilityEngine.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    /**
+     * @brief Backtracking enumerator over one component
+     *
+     * Variables are visited in breadth-first order over shared numbers so
+     * every number is closed as early as possible. The current assignment is
+     * kept as a bitset; each number tracks assigned mines and unassigned cells
+     * so infeasible branches are cut immediately.
+     */
+    struct Enumerator
+    {
+        int cells{0};
+        std::vector<std::vector<int>> constraintsOf; ///< Numbers touching the variable at each position
+        std::vector<int> order;                      ///< Position -> cell index within the component
+        std::vector<int> need;                       ///< Number value per constraint
+        std::vector<int> mines;                      ///< Mines assigned so far per constraint
+        std::vector<int> unassigned;                 ///< Cells not yet assigned per constraint
+        std::vector<std::uint64_t> assignment;       ///< Bit per position: 1 = mine
+        std::vector<double> ways;
+        std::vector<double> cellWays;
+        std::size_t nodes{0};
+        std::size_t budget{0};
+        bool aborted{false};
+
+        void run(int position, int used)
+        {
+            if (aborted || ++nodes > budget)
+            {
+                aborted = true;
+                return;
+            }
+
+            if (position == cells)
+            {
+                ways[used] += 1;
+                double *row = &cellWays[static_cast<std::size_t>(used) * cells];
+                for (std::size_t w = 0; w < assignment.size(); ++w)
+                    for (std::uint64_t bits = assignment[w]; bits; bits &= bits - 1)
+                        row[order[w * 64 + std::countr_zero(bits)]] += 1;
+                return;
+            }
+
+            for (int value = 0; value <= 1; ++value)
+            {
+                bool feasible = true;
+                for (const int c : constraintsOf[position])
+                {
+                    const int assigned = mines[c] + value;
+                    if (assigned > need[c] || assigned + unassigned[c] - 1 < need[c])
+                    {
+                        feasible = false;
+                        break;
+                    }
+                }
+                if (!feasible)
+                    continue;
+
+                for (const int c : constraintsOf[position])
+                {
+                    mines[c] += value;
+                    --unassigned[c];
+                }
+                if (value)
+                    assignment[position >> 6] |= std::uint64_t{1} << (position & 63);
+
+                run(position + 1, used + value);
+
+                if (value)
+                    assignment[position >> 6] &= ~(std::uint64_t{1} << (position & 63));
+                for (const int c : constraintsOf[position])
+                {
+                    mines[c] -= value;
+                    ++unassigned[c];
+                }
+            }
+        }
+    };
+
+    std::uint64_t hashSignature(const std::vector<std::uint32_t> &signature)
+    {
+        std::uint64_t hash = 0x9E3779B97F4A7C15ull ^ signature.size();
+        for (const std::uint32_t value : signature)
+        {
+            SplitMix64 mix(hash ^ value);
+            hash = mix();
+        }
+        return hash;
+    }
+
+    double logChoose(double n, double k)
+    {
+        return std::lgamma(n + 1) - std::lgamma(k + 1) - std::lgamma(n - k + 1);
+    }
+
+    // Scales a weight vector so its largest entry is 1 (ratios are all the engine needs)
+    void normalise(std::vector<double> &values)
+    {
+        const double largest = values.empty() ? 0.0 : *std::ranges::max_element(values);
+        if (largest > 0)
+            for (double &value : values)
+                value /= largest;
+    }
+
+    /// Tail weights below this fraction of the peak are dropped once the distributions are tilted
+    constexpr double Negligible = 1e-30;
+
+    /**
+     * @brief Weights by number of mines: values[i] belongs to offset + i mines (empty = impossible)
+     */
+    struct Weights
+    {
+        int offset{0};
+        std::vector<double> values;
+    };
+
+    // Keeps the counts in [low, high] whose weight is not negligible, and scales the peak to 1
+    void trim(Weights &weights, int low, int high)
+    {
+        std::vector<double> &values = weights.values;
+        std::size_t first = static_cast<std::size_t>(std::max(0, low - weights.offset));
+        std::size_t last = static_cast<std::size_t>(
+                std::clamp(high - weights.offset + 1, 0, static_cast<int>(values.size())));
+        const double largest = first < last ? *std::max_element(values.begin() + first, values.begin() + last) : 0.0;
+        if (largest <= 0)
+        {
+            values.clear();
+            return;
+        }
+
+        while (values[first] < largest * Negligible)
+            ++first;
+        while (values[last - 1] < largest * Negligible)
+            --last;
+
+        values.erase(values.begin() + last, values.end());
+        values.erase(values.begin(), values.begin() + first);
+        weights.offset += static_cast<int>(first);
+        for (double &value : values)
+            value /= largest;
+    }
+
+    Weights convolve(const Weights &a, const Weights &b)
+    {
+        Weights result;
+        if (a.values.empty() || b.values.empty())
+            return result;
+
+        result.offset = a.offset + b.offset;
+        result.values.assign(a.values.size() + b.values.size() - 1, 0.0);
+        for (std::size_t i = 0; i < a.values.size(); ++i)
+            for (std::size_t j = 0; j < b.values.size(); ++j)
+                result.values[i + j] += a.values[i] * b.values[j];
+        return result;
+    }
+
+    // For every count a of target: the sum over counts b of other of other(b) * context(a + b)
+    Weights correlate(const Weights &context, const Weights &other, const Weights &target)
+    {
+        Weights result{target.offset, std::vector<double>(target.values.size(), 0.0)};
+        const int contextSize = static_cast<int>(context.values.size());
+        const int otherSize = static_cast<int>(other.values.size());
+
+        for (int i = 0; i < static_cast<int>(result.values.size()); ++i)
+        {
+            // Index of context for other's first count; only the overlapping part contributes
+            const int base = target.offset + i + other.offset - context.offset;
+            const int first = std::max(0, -base);
+            const int last = std::min(otherSize, contextSize - base);
+            double sum = 0;
+            for (int j = first; j < last; ++j)
+                sum += other.values[j] * context.values[base + j];
+            result.values[i] = sum;
+        }
+        normalise(result.values);
+        return result;
+    }
+
+    /**
+     * @brief Products of the components' distributions over a balanced binary tree
+     *
+     * Node 1 covers every component and node i splits into 2i and 2i + 1. Each
+     * node keeps the distribution of the mines its components hold, trimmed to
+     * the counts that can still reach the feasible window. Going down, the
+     * weight of everything outside a node is one correlation of its parent's
+     * context with its sibling, so no per-component pass over the whole
+     * frontier is needed.
+     */
+    class ProductTree
+    {
+    private:
+        std::vector<Weights> nodes;
+        int low;      ///< Fewest frontier mines allowed in total
+        int high;     ///< Most frontier mines allowed in total
+        int frontier; ///< Frontier cells in all components
+
+        int build(std::size_t node, std::size_t first, std::size_t last, std::vector<Weights> &leaves,
+                  const std::vector<int> &cells)
+        {
+            int count = 0;
+            if (last - first == 1)
+            {
+                nodes[node] = std::move(leaves[first]);
+                count = cells[first];
+            }
+            else
+            {
+                const std::size_t middle = first + (last - first) / 2;
+                count = build(2 * node, first, middle, leaves, cells) + build(2 * node + 1, middle, last, leaves, cells);
+                nodes[node] = convolve(nodes[2 * node], nodes[2 * node + 1]);
+            }
+            // The other components hold at most frontier - count mines
+            trim(nodes[node], low - (frontier - count), high);
+            return count;
+        }
+
+        template <typename Visit>
+        void spread(std::size_t node, std::size_t first, std::size_t last, const Weights &context, Visit &visit)
+        {
+            if (last - first == 1)
+            {
+                visit(first, nodes[node], context);
+                return;
+            }
+
+            const std::size_t middle = first + (last - first) / 2;
+            const Weights left = correlate(context, nodes[2 * node + 1], nodes[2 * node]);
+            const Weights right = correlate(context, nodes[2 * node], nodes[2 * node + 1]);
+            spread(2 * node, first, middle, left, visit);
+            spread(2 * node + 1, middle, last, right, visit);
+        }
+
+    public:
+        ProductTree(std::vector<Weights> &leaves, const std::vector<int> &cells, int low, int high)
+            : nodes(4 * leaves.size()), low(low), high(high), frontier(0)
+        {
+            for (const int count : cells)
+                frontier += count;
+            if (!leaves.empty())
+                build(1, 0, leaves.size(), leaves, cells);
+        }
+
+        /**
+         * @brief Gets the distribution of the mines held by all components together
+         */
+        Weights root() const { return nodes.empty() ? Weights{0, {1.0}} : nodes[1]; }
+
+        /**
+         * @brief Calls visit(component, distribution, outside) for every component
+         * @param context Weight of every total number of frontier mines
+         * @param visit Receives the component's distribution and, for each of its counts, the
+         *              weight of all other components and the interior together
+         */
+        template <typename Visit>
+        void spread(const Weights &context, Visit visit)
+        {
+            // Aligned to the counts of the root, like every context below it
+            if (!nodes.empty())
+                spread(1, 0, nodes.size() / 4, correlate(context, Weights{0, {1.0}}, nodes[1]), visit);
+        }
+    };
+}
+
+// Constructor - binds the board; nothing is computed until compute()
+ProbabilityEngine::ProbabilityEngine(const Board &board, std::size_t nodeBudget)
+    : board(board), nodeBudget(nodeBudget)
+{
+}
+
+// * Internals
+std::int32_t ProbabilityEngine::find(std::int32_t cell)
+{
+    while (frontierId[cell] != cell)
+    {
+        frontierId[cell] = frontierId[frontierId[cell]]; // path halving
+        cell = frontierId[cell];
+    }
+    return cell;
+}
+
+void ProbabilityEngine::buildComponents()
+{
+    const std::vector<Cell> &cells = board.getBoard();
+    const int columns = board.getColumns();
+    const int rows = board.getRows();
+
+    frontierId.assign(cells.size(), -1);
+    components.clear();
+
+    std::vector<std::pair<std::uint32_t, std::int32_t>> numbers; // (number, one of its hidden neighbours)
+    std::vector<std::uint32_t> frontier;
+
+    // Union every hidden neighbour of a number with the first one
+    for (int r = 0; r < rows; ++r)
+    {
+        for (int c = 0; c < columns; ++c)
+        {
+            const std::size_t index = board.index(c, r);
+            if (!cells[index].isRevealed() || cells[index].getNearbyMines() == 0)
+                continue;
+
+            std::int32_t first = -1;
+            for (int nr = std::max(0, r - 1); nr <= std::min(rows - 1, r + 1); ++nr)
+            {
+                for (int nc = std::max(0, c - 1); nc <= std::min(columns - 1, c + 1); ++nc)
+                {
+                    const auto neighbor = static_cast<std::int32_t>(board.index(nc, nr));
+                    if (cells[neighbor].isRevealed())
+                        continue;
+
+                    if (frontierId[neighbor] < 0)
+                    {
+                        frontierId[neighbor] = neighbor;
+                        frontier.push_back(static_cast<std::uint32_t>(neighbor));
+                    }
+
+                    if (first < 0)
+                        first = neighbor;
+                    else
+                        frontierId[find(neighbor)] = find(first);
+                }
+            }
+
+            if (first >= 0)
+                numbers.emplace_back(static_cast<std::uint32_t>(index), first);
+        }
+    }
+
+    // Group cells and numbers by root
+    std::unordered_map<std::int32_t, std::size_t> componentOf;
+    std::ranges::sort(frontier);
+    for (const std::uint32_t cell : frontier)
+    {
+        auto [it, inserted] = componentOf.try_emplace(find(static_cast<std::int32_t>(cell)), components.size());
+        if (inserted)
+            components.emplace_back();
+        components[it->second].cells.push_back(cell);
+    }
+
+    for (const auto &[number, neighbor] : numbers)
+        components[componentOf[find(neighbor)]].constraints.push_back(number);
+}
+
+const ProbabilityEngine::ComponentResult &ProbabilityEngine::resultFor(const Component &component)
+{
+    const std::vector<Cell> &cells = board.getBoard();
+
+    std::vector<std::uint32_t> signature = component.cells;
+    signature.push_back(std::numeric_limits<std::uint32_t>::max());
+    for (const std::uint32_t number : component.constraints)
+    {
+        signature.push_back(number);
+        signature.push_back(static_cast<std::uint32_t>(cells[number].getNearbyMines()));
+    }
+
+    const std::uint64_t key = hashSignature(signature);
+    auto it = cache.find(key);
+    if (it != cache.end() && it->second.signature == signature)
+    {
+        ++cacheHits;
+        it->second.used = true;
+        return it->second;
+    }
+
+    ++cacheMisses;
+    ComponentResult result = enumerate(component);
+    result.signature = std::move(signature);
+    result.used = true;
+    return cache.insert_or_assign(key, std::move(result)).first->second;
+}
+
+ProbabilityEngine::ComponentResult ProbabilityEngine::enumerate(const Component &component) const
+{
+    const std::vector<Cell> &cells = board.getBoard();
+    const int columns = board.getColumns();
+    const int rows = board.getRows();
+    const int n = static_cast<int>(component.cells.size());
+
+    // Beyond this the per-count table alone outgrows the budget (and would take long to clear)
+    if (static_cast<std::size_t>(n + 1) * static_cast<std::size_t>(n) > nodeBudget)
+    {
+        ComponentResult result;
+        result.exact = false;
+        return result;
+    }
+
+    auto variableOf = [&component](std::uint32_t cell) {
+        return static_cast<int>(std::ranges::lower_bound(component.cells, cell) - component.cells.begin());
+    };
+
+    // Variables of every number, and numbers of every variable
+    std::vector<std::vector<int>> variablesOf(component.constraints.size());
+    std::vector<std::vector<int>> numbersOf(n);
+    Enumerator enumerator;
+
+    for (std::size_t i = 0; i < component.constraints.size(); ++i)
+    {
+        const std::uint32_t number = component.constraints[i];
+        const int c = static_cast<int>(number % columns);
+        const int r = static_cast<int>(number / columns);
+        for (int nr = std::max(0, r - 1); nr <= std::min(rows - 1, r + 1); ++nr)
+        {
+            for (int nc = std::max(0, c - 1); nc <= std::min(columns - 1, c + 1); ++nc)
+            {
+                const std::size_t neighbor = board.index(nc, nr);
+                if (cells[neighbor].isRevealed())
+                    continue;
+                const int variable = variableOf(static_cast<std::uint32_t>(neighbor));
+                variablesOf[i].push_back(variable);
+                numbersOf[variable].push_back(static_cast<int>(i));
+            }
+        }
+        enumerator.need.push_back(cells[number].getNearbyMines());
+        enumerator.unassigned.push_back(static_cast<int>(variablesOf[i].size()));
+    }
+
+    // Breadth-first order over shared numbers
+    std::vector<int> position(n, -1);
+    for (int seed = 0; seed < n; ++seed)
+    {
+        if (position[seed] >= 0)
+            continue;
+        position[seed] = static_cast<int>(enumerator.order.size());
+        enumerator.order.push_back(seed);
+        for (std::size_t head = enumerator.order.size() - 1; head < enumerator.order.size(); ++head)
+            for (const int number : numbersOf[enumerator.order[head]])
+                for (const int variable : variablesOf[number])
+                    if (position[variable] < 0)
+                    {
+                        position[variable] = static_cast<int>(enumerator.order.size());
+                        enumerator.order.push_back(variable);
+                    }
+    }
+
+    enumerator.cells = n;
+    enumerator.constraintsOf.resize(n);
+    for (int v = 0; v < n; ++v)
+        enumerator.constraintsOf[position[v]] = numbersOf[v];
+    enumerator.mines.assign(component.constraints.size(), 0);
+    enumerator.assignment.assign((n + 63) / 64, 0);
+    enumerator.ways.assign(n + 1, 0.0);
+    enumerator.cellWays.assign(static_cast<std::size_t>(n + 1) * n, 0.0);
+    enumerator.budget = nodeBudget;
+    enumerator.run(0, 0);
+
+    ComponentResult result;
+    result.exact = !enumerator.aborted && std::ranges::any_of(enumerator.ways, [](double w) { return w > 0; });
+    if (result.exact)
+    {
+        const double largest = *std::ranges::max_element(enumerator.ways);
+        for (double &w : enumerator.ways)
+            w /= largest;
+        for (double &w : enumerator.cellWays)
+            w /= largest;
+        result.ways = std::move(enumerator.ways);
+        result.cellWays = std::move(enumerator.cellWays);
+    }
+    return result;
+}
+
+void ProbabilityEngine::combine()
+{
+    const int totalCells = static_cast<int>(board.getBoard().size());
+    const int unrevealed = board.getHiddenCount() + board.getFlagCount();
+    const int revealedMines = totalCells - unrevealed - board.getRevealedSafeCount();
+    const int minesLeft = board.getMines() - revealedMines;
+
+    std::vector<const Component *> exact;
+    std::vector<int> sizes;
+    int frontierCells = 0;
+    for (const Component &component : components)
+    {
+        if (component.result->exact)
+        {
+            exact.push_back(&component);
+            sizes.push_back(static_cast<int>(component.cells.size()));
+            frontierCells += sizes.back();
+        }
+    }
+    const int interior = unrevealed - frontierCells;
+
+    // Only these frontier totals leave a placeable number of mines for the interior
+    const int low = std::max(0, minesLeft - interior);
+    const int high = std::min(minesLeft, frontierCells);
+
+    // Tilt every component by e^(t * mines), with t the slope of log C(U, M - s) where the tilted
+    // frontier total is expected to fall (solved by bisection). Tilting changes no ratio, but it
+    // centres all distributions on the likely totals, so their far tails can be dropped safely.
+    std::vector<std::vector<double>> logWays(exact.size());
+    for (std::size_t i = 0; i < exact.size(); ++i)
+        for (const double ways : exact[i]->result->ways)
+            logWays[i].push_back(ways > 0 ? std::log(ways) : -std::numeric_limits<double>::infinity());
+
+    auto expectedMines = [&logWays](double t) {
+        double expected = 0;
+        for (const std::vector<double> &logs : logWays)
+        {
+            double peak = -std::numeric_limits<double>::infinity();
+            for (std::size_t k = 0; k < logs.size(); ++k)
+                peak = std::max(peak, logs[k] + t * static_cast<double>(k));
+            double weight = 0, mines = 0;
+            for (std::size_t k = 0; k < logs.size(); ++k)
+            {
+                const double w = std::exp(logs[k] + t * static_cast<double>(k) - peak);
+                weight += w;
+                mines += w * static_cast<double>(k);
+            }
+            expected += weight > 0 ? mines / weight : 0.0;
+        }
+        return expected;
+    };
+    // Total s at which d/ds log C(U, M - s) = log((M - s) / (U - M + s + 1)) equals t
+    auto tangentPoint = [&](double t) {
+        const double odds = std::exp(t);
+        const double s = (minesLeft - odds * (interior - minesLeft + 1)) / (1 + odds);
+        return std::clamp(s, static_cast<double>(low), static_cast<double>(std::max(low, high)));
+    };
+
+    double tiltLow = -60, tiltHigh = 60;
+    for (int step = 0; step < 50; ++step)
+    {
+        const double middle = (tiltLow + tiltHigh) / 2;
+        (expectedMines(middle) < tangentPoint(middle) ? tiltLow : tiltHigh) = middle;
+    }
+    const double tilt = (tiltLow + tiltHigh) / 2;
+
+    std::vector<Weights> leaves(exact.size());
+    for (std::size_t i = 0; i < exact.size(); ++i)
+    {
+        const std::vector<double> &logs = logWays[i];
+        double peak = -std::numeric_limits<double>::infinity();
+        for (std::size_t k = 0; k < logs.size(); ++k)
+            peak = std::max(peak, logs[k] + tilt * static_cast<double>(k));
+        for (std::size_t k = 0; k < logs.size(); ++k)
+            leaves[i].values.push_back(std::exp(logs[k] + tilt * static_cast<double>(k) - peak));
+    }
+
+    // Interior weight of each feasible total, tilted the same way
+    Weights binomial{low, {}};
+    double largestLog = -std::numeric_limits<double>::infinity();
+    for (int s = low; s <= high; ++s)
+        largestLog = std::max(largestLog, logChoose(interior, minesLeft - s) - tilt * s);
+    for (int s = low; s <= high; ++s)
+        binomial.values.push_back(std::exp(logChoose(interior, minesLeft - s) - tilt * s - largestLog));
+
+    ProductTree tree(leaves, sizes, low, high);
+    const Weights total = tree.root();
+
+    // Each component's cells: its solutions weighted by what all other components and the interior allow
+    std::vector<double> mine;
+    tree.spread(binomial, [&](std::size_t i, const Weights &own, const Weights &outside) {
+        const Component &component = *exact[i];
+        const ComponentResult &result = *component.result;
+        const std::size_t n = component.cells.size();
+
+        mine.assign(n, 0.0);
+        double weight = 0;
+        for (std::size_t j = 0; j < own.values.size(); ++j)
+        {
+            const std::size_t k = static_cast<std::size_t>(own.offset) + j;
+            if (result.ways[k] <= 0)
+                continue;
+            // own is ways[k] tilted and rescaled; the same factor applies to cellWays[k]
+            const double factor = own.values[j] * outside.values[j] / result.ways[k];
+            weight += result.ways[k] * factor;
+            const double *row = &result.cellWays[k * n];
+            for (std::size_t v = 0; v < n; ++v)
+                mine[v] += row[v] * factor;
+        }
+        for (std::size_t v = 0; v < n; ++v)
+            probability[component.cells[v]] = weight > 0 ? mine[v] / weight : 0.0;
+    });
+
+    // Interior cells share the expected number of mines not on the frontier
+    double interiorProbability = 0;
+    if (interior > 0)
+    {
+        double weight = 0, expected = 0;
+        for (std::size_t j = 0; j < total.values.size(); ++j)
+        {
+            const int s = total.offset + static_cast<int>(j);
+            if (s < low || s > high)
+                continue;
+            const double w = total.values[j] * binomial.values[s - low];
+            weight += w;
+            expected += w * (minesLeft - s);
+        }
+        interiorProbability = weight > 0 ? expected / weight / interior : 0.0;
+    }
+
+    const std::vector<Cell> &cells = board.getBoard();
+    for (std::size_t i = 0; i < cells.size(); ++i)
+    {
+        if (cells[i].isRevealed())
+            probability[i] = 0.0;
+        else if (frontierId[i] < 0)
+            probability[i] = interiorProbability;
+    }
+    for (const Component &component : components)
+        if (!component.result->exact)
+            for (const std::uint32_t cell : component.cells)
+                probability[cell] = interiorProbability;
+}
+
+// * Interaction
+void ProbabilityEngine::compute()
+{
+    probability.assign(board.getBoard().size(), 0.0);
+    buildComponents();
+
+    for (auto &[key, result] : cache)
+        result.used = false;
+
+    for (Component &component : components)
+        component.result = &resultFor(component);
+
+    // Components that disappeared will not come back in the same shape; drop them
+    std::erase_if(cache, [](const auto &entry) { return !entry.second.used; });
+
+    combine();
+}
+
+bool ProbabilityEngine::bestGuess(int &column, int &row) const
+{
+    const std::vector<Cell> &cells = board.getBoard();
+    double best = 2.0;
+    std::size_t bestIndex = cells.size();
+
+    for (std::size_t i = 0; i < cells.size(); ++i)
+    {
+        if (cells[i].isHidden() && probability[i] < best)
+        {
+            best = probability[i];
+            bestIndex = i;
+        }
+    }
+
+    if (bestIndex == cells.size())
+        return false;
+
+    column = static_cast<int>(bestIndex % board.getColumns());
+    row = static_cast<int>(bestIndex / board.getColumns());
+    return true;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file ReplayReader.cpp
+ * @brief Implementation of the replay decoder
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "ReplayReader.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+using namespace ReplayFormat;
+
+ReplayReader::ReplayReader(std::vector<std::uint8_t> bytes) : data(std::move(bytes))
+{
+    if (data.size() < Magic.size() + 2 || !std::equal(Magic.begin(), Magic.end(), data.begin()))
+        throw std::runtime_error("not a replay file");
+    if (data[Magic.size()] != Version)
+        throw std::runtime_error("unsupported replay version " + std::to_string(data[Magic.size()]));
+
+    const std::uint8_t flags = data[Magic.size() + 1];
+    cursor = Magic.size() + 2;
+
+    header.columns = static_cast<int>(readVarint());
+    header.rows = static_cast<int>(readVarint());
+    header.mines = static_cast<int>(readVarint());
+    header.seed = readVarint();
+    header.history = flags & FlagHistory;
+
+    if (header.columns <= 0 || header.rows <= 0 || header.mines < 0 ||
+        static_cast<std::int64_t>(header.columns) * header.rows > INT32_MAX)
+        throw std::runtime_error("invalid board size in replay header");
+
+    if (flags & FlagSafeStart)
+    {
+        header.safeColumn = static_cast<int>(readVarint());
+        header.safeRow = static_cast<int>(readVarint());
+        if (header.safeColumn >= header.columns || header.safeRow >= header.rows)
+            throw std::runtime_error("invalid safe cell in replay header");
+    }
+
+    if (flags & FlagLayout)
+    {
+        const std::size_t bytesNeeded = (static_cast<std::size_t>(header.columns) * header.rows + 7) / 8;
+        if (data.size() - cursor < bytesNeeded)
+            throw std::runtime_error("replay ends inside the mine layout");
+        header.layout.assign(data.begin() + static_cast<std::ptrdiff_t>(cursor),
+                             data.begin() + static_cast<std::ptrdiff_t>(cursor + bytesNeeded));
+        cursor += bytesNeeded;
+    }
+
+    recordsBegin = cursor;
+}
+
+ReplayReader ReplayReader::fromFile(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        throw std::runtime_error("cannot open " + path);
+
+    std::vector<std::uint8_t> bytes{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    return ReplayReader(std::move(bytes));
+}
+
+// * Internals
+std::uint64_t ReplayReader::readVarint()
+{
+    std::uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (cursor == data.size())
+            throw std::runtime_error("replay is truncated");
+
+        const std::uint8_t byte = data[cursor++];
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+    throw std::runtime_error("invalid varint in replay");
+}
+
+MineLayer ReplayReader::storedLayout() const
+{
+    MineLayer layout(header.columns, header.rows);
+    for (int r = 0; r < header.rows; ++r)
+    {
+        for (int c = 0; c < header.columns; ++c)
+        {
+            const std::size_t i = static_cast<std::size_t>(r) * header.columns + c;
+            if (header.layout[i / 8] >> (i % 8) & 1)
+                layout.set(c, r);
+        }
+    }
+    return layout;
+}
+
+// * Interaction
+Game ReplayReader::createGame() const
+{
+    Game game = header.safeColumn >= 0
+                    ? Game(header.columns, header.rows, header.mines, header.seed, header.safeColumn, header.safeRow)
+                    : Game(header.columns, header.rows, header.mines, header.seed);
+
+    if (!header.layout.empty())
+        game.reset(storedLayout());
+
+    if (header.history)
+        game.enableHistory();
+    return game;
+}
+
+void ReplayReader::restart(Game &game) const
+{
+    if (!header.layout.empty())
+        game.reset(storedLayout());
+    else if (header.safeColumn >= 0)
+        game.reset(header.seed, header.safeColumn, header.safeRow);
+    else
+        game.reset(header.seed);
+}
+
+bool ReplayReader::next(Record &record)
+{
+    if (cursor == data.size())
+        return false;
+
+    const std::uint64_t key = readVarint();
+    const auto code = static_cast<std::size_t>(key & ((1u << ActionBits) - 1));
+    if (code >= Actions.size())
+        throw std::runtime_error("invalid action in replay");
+
+    record.move.action = Actions[code];
+    if (record.move.action == 'U' || record.move.action == 'Y')
+    {
+        record.move.column = 0;
+        record.move.row = 0;
+    }
+    else
+    {
+        lastColumn += static_cast<int>(unzigzag(key >> ActionBits));
+        lastRow += static_cast<int>(unzigzag(readVarint()));
+        record.move.column = lastColumn;
+        record.move.row = lastRow;
+    }
+    record.elapsedMs = static_cast<std::uint32_t>(readVarint());
+    return true;
+}
+
+void ReplayReader::rewind()
+{
+    cursor = recordsBegin;
+    lastColumn = 0;
+    lastRow = 0;
+}
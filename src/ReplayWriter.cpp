@@ -0,0 +1,85 @@
+/**
+ * @file ReplayWriter.cpp
+ * @brief Implementation of the streaming replay encoder
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "ReplayWriter.h"
+
+#include <algorithm>
+
+using namespace ReplayFormat;
+
+ReplayWriter::ReplayWriter(std::ostream &out, const Game &game, bool embedLayout)
+    : out(out), lastMove(std::chrono::steady_clock::now())
+{
+    const Board &board = game.getBoard();
+    const bool safeStart = board.getSafeColumn() >= 0;
+
+    std::uint8_t flags = 0;
+    if (safeStart)
+        flags |= FlagSafeStart;
+    if (embedLayout)
+        flags |= FlagLayout;
+    if (game.isHistoryEnabled())
+        flags |= FlagHistory;
+
+    buffer.assign(Magic.begin(), Magic.end());
+    buffer += static_cast<char>(Version);
+    buffer += static_cast<char>(flags);
+    putVarint(buffer, static_cast<std::uint64_t>(board.getColumns()));
+    putVarint(buffer, static_cast<std::uint64_t>(board.getRows()));
+    putVarint(buffer, static_cast<std::uint64_t>(board.getMines()));
+    putVarint(buffer, board.getSeed());
+
+    if (safeStart)
+    {
+        putVarint(buffer, static_cast<std::uint64_t>(board.getSafeColumn()));
+        putVarint(buffer, static_cast<std::uint64_t>(board.getSafeRow()));
+    }
+
+    if (embedLayout)
+    {
+        const std::vector<Cell> &cells = board.getBoard();
+        std::string layout((cells.size() + 7) / 8, '\0');
+        for (std::size_t i = 0; i < cells.size(); ++i)
+            if (cells[i].isMine())
+                layout[i / 8] = static_cast<char>(layout[i / 8] | 1 << (i % 8));
+        buffer += layout;
+    }
+
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    out.flush();
+}
+
+void ReplayWriter::append(const InputData &move)
+{
+    const auto now = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastMove).count();
+    lastMove = now;
+    append(move, static_cast<std::uint32_t>(std::clamp<std::int64_t>(elapsed, 0, UINT32_MAX)));
+}
+
+void ReplayWriter::append(const InputData &move, std::uint32_t elapsedMs)
+{
+    const int code = actionCode(move.action);
+    if (code < 0)
+        return;
+
+    buffer.clear();
+    if (move.action == 'U' || move.action == 'Y')
+    {
+        putVarint(buffer, static_cast<std::uint64_t>(code));
+    }
+    else
+    {
+        putVarint(buffer, zigzag(move.column - lastColumn) << ActionBits | static_cast<std::uint64_t>(code));
+        putVarint(buffer, zigzag(move.row - lastRow));
+        lastColumn = move.column;
+        lastRow = move.row;
+    }
+    putVarint(buffer, elapsedMs);
+
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
@@ -0,0 +1,315 @@
+/**
+ * @file SessionManager.cpp
+ * @brief Implementation of the multi-session line protocol
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "SessionManager.h"
+
+#include <algorithm>
+#include <charconv>
+
+#include "MoveParser.h"
+
+namespace
+{
+    bool isSpace(char ch) { return ch == ' ' || ch == '\t' || ch == '\r'; }
+
+    // Splits off the next whitespace-separated word
+    std::string_view nextWord(std::string_view &text)
+    {
+        while (!text.empty() && isSpace(text.front()))
+            text.remove_prefix(1);
+
+        std::size_t end = 0;
+        while (end < text.size() && !isSpace(text[end]))
+            ++end;
+
+        const std::string_view word = text.substr(0, end);
+        text.remove_prefix(end);
+        return word;
+    }
+
+    template <typename T>
+    bool parseNumber(std::string_view word, T &value)
+    {
+        const auto [end, error] = std::from_chars(word.data(), word.data() + word.size(), value);
+        return !word.empty() && error == std::errc{} && end == word.data() + word.size();
+    }
+
+    bool equalsUpper(std::string_view word, std::string_view command)
+    {
+        return std::ranges::equal(word, command,
+                                  [](char a, char b) { return MoveParser::toUpper(a) == b; });
+    }
+
+    void appendNumber(std::string &out, std::int64_t value)
+    {
+        char digits[24];
+        const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        out += ' ';
+        out.append(digits, result.ptr);
+    }
+}
+
+// Constructor - no sessions yet
+SessionManager::SessionManager(BoardLimits limits, std::size_t maxSessions, std::size_t maxCells)
+    : limits(limits), maxSessions(maxSessions), maxCells(maxCells)
+{
+}
+
+// * Internals
+std::shared_ptr<SessionManager::Session> SessionManager::find(std::uint32_t id) const
+{
+    std::shared_lock guard(tableLock);
+    const auto it = sessions.find(id);
+    return it == sessions.end() ? nullptr : it->second;
+}
+
+void SessionManager::create(std::string_view arguments, std::string &out, std::vector<std::uint32_t> &owned)
+{
+    int columns = 0, rows = 0, mines = -1;
+    std::uint64_t seed = 0;
+    const bool sized = parseNumber(nextWord(arguments), columns) && parseNumber(nextWord(arguments), rows);
+    const std::string_view minesWord = nextWord(arguments);
+    const std::string_view seedWord = nextWord(arguments);
+
+    if (!sized || (!minesWord.empty() && !parseNumber(minesWord, mines)) ||
+        (!seedWord.empty() && !parseNumber(seedWord, seed)) || !nextWord(arguments).empty())
+    {
+        out += "ERR usage: CREATE <columns> <rows> [mines] [seed]\n";
+        return;
+    }
+    if (!limits.accepts(columns, rows))
+    {
+        out += "ERR size must be between " + std::to_string(limits.minSize) + " and " +
+               std::to_string(limits.maxSize) + ", with at most " + std::to_string(BoardLimits::MaxCells) +
+               " cells\n";
+        return;
+    }
+
+    if (minesWord.empty())
+        mines = std::max(1, columns * rows / 8);
+    if (seedWord.empty())
+        seed = Board::randomSeed();
+    if (mines < 0 || mines >= columns * rows)
+    {
+        out += "ERR invalid mine count\n";
+        return;
+    }
+
+    // Refuse early what cannot fit, before a board is generated for nothing
+    const std::size_t cells = static_cast<std::size_t>(columns) * rows;
+    {
+        std::shared_lock guard(tableLock);
+        if (openCells + cells > maxCells)
+        {
+            out += "ERR too many cells\n";
+            return;
+        }
+    }
+
+    // The board is generated (or a pooled one regenerated) outside the table lock; only the insertion is serialised
+    auto session = std::make_shared<Session>();
+    session->game = pool.acquire(columns, rows, mines, seed);
+    session->cells = cells;
+    std::uint32_t id = 0;
+    {
+        std::unique_lock guard(tableLock);
+        if (sessions.size() >= maxSessions)
+        {
+            out += "ERR too many sessions\n";
+            return;
+        }
+        if (openCells + cells > maxCells)
+        {
+            out += "ERR too many cells\n";
+            return;
+        }
+        openCells += cells;
+        // Ids wrap after 2^32 CREATEs; skip the ones still open (try_emplace leaves session alone on a clash)
+        do
+            id = nextId.fetch_add(1, std::memory_order_relaxed);
+        while (!sessions.try_emplace(id, std::move(session)).second);
+    }
+
+    owned.push_back(id);
+    out += "OK";
+    appendNumber(out, id);
+    out += ' ';
+    out += std::to_string(seed);
+    out += '\n';
+}
+
+void SessionManager::play(Game &game, std::string_view moves, std::string &out)
+{
+    if (!game.playLine(moves))
+    {
+        out += "ERR invalid moves\n";
+        return;
+    }
+
+    out += "OK";
+    appendNumber(out, game.getStateValue());
+    appendNumber(out, static_cast<std::int64_t>(game.getChanges().size()));
+    out += '\n';
+}
+
+void SessionManager::batch(Game &game, std::string_view arguments, std::string &out)
+{
+    // Moves are parsed into a per-thread buffer, so a steady stream of batches allocates nothing
+    thread_local std::vector<InputData> moves;
+    moves.clear();
+
+    for (std::string_view word = nextWord(arguments); !word.empty(); word = nextWord(arguments))
+    {
+        InputData move{};
+        const std::string_view rowWord = nextWord(arguments);
+        const std::string_view actionWord = nextWord(arguments);
+        if (!parseNumber(word, move.column) || !parseNumber(rowWord, move.row) || actionWord.size() != 1)
+        {
+            out += "ERR usage: BATCH <id> <column> <row> <R|F|C> ...\n";
+            return;
+        }
+        move.action = MoveParser::toUpper(actionWord.front());
+        moves.push_back(move);
+    }
+
+    const std::size_t played = game.playBatch(moves, {});
+    out += "OK";
+    appendNumber(out, static_cast<std::int64_t>(played));
+    appendNumber(out, game.getStateValue());
+    out += '\n';
+}
+
+void SessionManager::status(const Game &game, std::string &out)
+{
+    const GameStatus status = game.getStatus();
+    out += "OK";
+    for (const std::int32_t field : {status.columns, status.rows, status.mines, status.flags, status.revealed,
+                                     status.state, status.moves, status.elapsedMs, status.lastRevealed,
+                                     status.threeBV})
+        appendNumber(out, field);
+    out += '\n';
+}
+
+void SessionManager::view(const Game &game, std::string &out)
+{
+    const Board &board = game.getBoard();
+    out += "OK";
+    appendNumber(out, board.getColumns());
+    appendNumber(out, board.getRows());
+    out += ' ';
+
+    const std::size_t start = out.size();
+    out.resize(start + board.getBoard().size());
+    char *text = out.data() + start;
+    for (const Cell cell : board.getBoard())
+    {
+        if (cell.isFlagged())
+            *text++ = 'F';
+        else if (!cell.isRevealed())
+            *text++ = '#';
+        else if (cell.isMine())
+            *text++ = '*';
+        else
+            *text++ = static_cast<char>('0' + cell.getNearbyMines());
+    }
+    out += '\n';
+}
+
+// * Interaction
+void SessionManager::handle(std::string_view line, std::string &out, std::vector<std::uint32_t> &owned)
+{
+    const std::string_view command = nextWord(line);
+
+    if (equalsUpper(command, "CREATE"))
+    {
+        create(line, out, owned);
+        return;
+    }
+
+    const bool known = equalsUpper(command, "PLAY") || equalsUpper(command, "BATCH") ||
+                       equalsUpper(command, "STATUS") || equalsUpper(command, "VIEW") ||
+                       equalsUpper(command, "CLOSE");
+    if (!known)
+    {
+        out += command.empty() ? "ERR empty request\n" : "ERR unknown command\n";
+        return;
+    }
+
+    std::uint32_t id = 0;
+    if (!parseNumber(nextWord(line), id))
+    {
+        out += "ERR missing session id\n";
+        return;
+    }
+
+    if (equalsUpper(command, "CLOSE"))
+    {
+        // The game goes back to the pool once the node is dropped, after the table lock
+        std::unique_lock guard(tableLock);
+        auto closed = sessions.extract(id);
+        if (closed)
+            openCells -= closed.mapped()->cells;
+        guard.unlock();
+        if (!closed)
+        {
+            out += "ERR no such session\n";
+            return;
+        }
+
+        // Forget it on this connection too, so CREATE/CLOSE churn does not grow the list (order does not matter)
+        const auto mine = std::ranges::find(owned, id);
+        if (mine != owned.end())
+        {
+            *mine = owned.back();
+            owned.pop_back();
+        }
+        out += "OK\n";
+        return;
+    }
+
+    const std::shared_ptr<Session> session = find(id);
+    if (!session)
+    {
+        out += "ERR no such session\n";
+        return;
+    }
+
+    std::scoped_lock guard(session->lock);
+    if (equalsUpper(command, "PLAY"))
+        play(*session->game, line, out);
+    else if (equalsUpper(command, "BATCH"))
+        batch(*session->game, line, out);
+    else if (equalsUpper(command, "STATUS"))
+        status(*session->game, out);
+    else
+        view(*session->game, out);
+}
+
+void SessionManager::close(std::span<const std::uint32_t> ids)
+{
+    std::vector<std::shared_ptr<Session>> closed;
+    closed.reserve(ids.size());
+
+    std::unique_lock guard(tableLock);
+    for (const std::uint32_t id : ids)
+    {
+        const auto it = sessions.find(id);
+        if (it == sessions.end())
+            continue;
+        openCells -= it->second->cells;
+        closed.push_back(std::move(it->second));
+        sessions.erase(it);
+    }
+    guard.unlock();
+    // The games return to the pool here, when the last references go
+}
+
+std::size_t SessionManager::size() const
+{
+    std::shared_lock guard(tableLock);
+    return sessions.size();
+}
@@ -0,0 +1,215 @@
+/**
+ * @file Solver.cpp
+ * @brief Implementation of the incremental constraint-propagation solver
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "Solver.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+    // Bit of offset (dr, dc) inside the 7x7 window centred on the examined cell
+    constexpr int bitOf(int dr, int dc) { return (dr + 3) * 7 + (dc + 3); }
+}
+
+// Constructor - binds the board and queues everything already visible
+Solver::Solver(const Board &board)
+    : board(board), columns(board.getColumns()), rows(board.getRows())
+{
+    reset();
+}
+
+void Solver::reset()
+{
+    const std::size_t cells = board.getBoard().size();
+    knowledge.assign(cells, Unknown);
+    queued.assign(cells, 0);
+    dirty.clear();
+    safeCells.clear();
+    mineCells.clear();
+    safeCursor = 0;
+    deductions = 0;
+
+    for (int r = 0; r < rows; ++r)
+        for (int c = 0; c < columns; ++c)
+            enqueue(c, r);
+}
+
+// * Internals
+bool Solver::isNumber(int column, int row) const
+{
+    const Cell cell = board.getBoard()[board.index(column, row)];
+    return cell.isRevealed() && cell.getNearbyMines() > 0;
+}
+
+void Solver::enqueue(int column, int row)
+{
+    const std::size_t index = board.index(column, row);
+    if (queued[index] || !isNumber(column, row))
+        return;
+
+    queued[index] = 1;
+    dirty.push_back(static_cast<std::uint32_t>(index));
+}
+
+void Solver::enqueueAround(int column, int row)
+{
+    for (int r = std::max(0, row - 1); r <= std::min(rows - 1, row + 1); ++r)
+        for (int c = std::max(0, column - 1); c <= std::min(columns - 1, column + 1); ++c)
+            enqueue(c, r);
+}
+
+Solver::Constraint Solver::constraintOf(int column, int row, int originColumn, int originRow) const
+{
+    Constraint constraint;
+    constraint.need = board.getBoard()[board.index(column, row)].getNearbyMines();
+
+    for (int r = std::max(0, row - 1); r <= std::min(rows - 1, row + 1); ++r)
+    {
+        for (int c = std::max(0, column - 1); c <= std::min(columns - 1, column + 1); ++c)
+        {
+            const std::size_t index = board.index(c, r);
+            if (board.getBoard()[index].isRevealed())
+                continue;
+
+            if (knowledge[index] == Mine)
+                --constraint.need;
+            else if (knowledge[index] == Unknown)
+                constraint.unknown |= std::uint64_t{1} << bitOf(r - originRow, c - originColumn);
+        }
+    }
+
+    return constraint;
+}
+
+int Solver::apply(std::uint64_t mask, int originColumn, int originRow, Knowledge value)
+{
+    int proven = 0;
+
+    for (; mask; mask &= mask - 1)
+    {
+        const int bit = std::countr_zero(mask);
+        const int column = originColumn + bit % 7 - 3;
+        const int row = originRow + bit / 7 - 3;
+        const std::size_t index = board.index(column, row);
+
+        if (knowledge[index] != Unknown)
+            continue;
+
+        knowledge[index] = value;
+        ++proven;
+        (value == Safe ? safeCells : mineCells).push_back(static_cast<std::uint32_t>(index));
+
+        // Numbers around the cell lose an unknown neighbour (and a mine lowers their need)
+        enqueueAround(column, row);
+    }
+
+    return proven;
+}
+
+int Solver::examine(std::uint32_t index)
+{
+    const int column = static_cast<int>(index % columns);
+    const int row = static_cast<int>(index / columns);
+    const Constraint self = constraintOf(column, row, column, row);
+    const int unknown = std::popcount(self.unknown);
+
+    if (unknown == 0)
+        return 0;
+
+    // Single cell rule
+    if (self.need == 0)
+        return apply(self.unknown, column, row, Safe);
+    if (self.need == unknown)
+        return apply(self.unknown, column, row, Mine);
+
+    // Pair rule against every number that can share an unknown neighbour (Chebyshev distance <= 2)
+    int proven = 0;
+    for (int r = std::max(0, row - 2); r <= std::min(rows - 1, row + 2); ++r)
+    {
+        for (int c = std::max(0, column - 2); c <= std::min(columns - 1, column + 2); ++c)
+        {
+            if ((r == row && c == column) || !isNumber(c, r))
+                continue;
+
+            const Constraint other = constraintOf(c, r, column, row);
+            if (!(other.unknown & self.unknown))
+                continue;
+
+            const std::uint64_t onlyOther = other.unknown & ~self.unknown;
+            const std::uint64_t onlySelf = self.unknown & ~other.unknown;
+            const int difference = other.need - self.need;
+
+            if (difference == std::popcount(onlyOther))
+            {
+                proven += apply(onlyOther, column, row, Mine);
+                proven += apply(onlySelf, column, row, Safe);
+            }
+            else if (-difference == std::popcount(onlySelf))
+            {
+                proven += apply(onlySelf, column, row, Mine);
+                proven += apply(onlyOther, column, row, Safe);
+            }
+
+            if (proven > 0)
+                return proven;
+        }
+    }
+
+    return proven;
+}
+
+// * Interaction
+void Solver::notifyRevealed(std::span<const CellChange> changes)
+{
+    // Flags are the player's opinion, not information
+    for (const CellChange &change : changes)
+        if (change.reason == ChangeReason::Revealed || change.reason == ChangeReason::Exploded)
+            enqueueAround(static_cast<int>(change.index % columns), static_cast<int>(change.index / columns));
+}
+
+int Solver::solve()
+{
+    int proven = 0;
+
+    while (!dirty.empty())
+    {
+        const std::uint32_t index = dirty.back();
+        dirty.pop_back();
+        queued[index] = 0;
+
+        const int found = examine(index);
+        if (found > 0)
+        {
+            proven += found;
+            // The examined number may yield more once the new knowledge is taken into account
+            enqueue(static_cast<int>(index % columns), static_cast<int>(index / columns));
+        }
+    }
+
+    deductions += proven;
+    return proven;
+}
+
+bool Solver::nextSafeCell(int &column, int &row)
+{
+    while (safeCursor < safeCells.size())
+    {
+        const std::uint32_t index = safeCells[safeCursor++];
+        if (board.getBoard()[index].isRevealed())
+            continue;
+
+        column = static_cast<int>(index % columns);
+        row = static_cast<int>(index / columns);
+        return true;
+    }
+
+    return false;
+}
+
+bool Solver::isKnownSafe(int column, int row) const { return knowledge[board.index(column, row)] == Safe; }
+bool Solver::isKnownMine(int column, int row) const { return knowledge[board.index(column, row)] == Mine; }
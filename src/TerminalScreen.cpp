@@ -0,0 +1,113 @@
+/**
+ * @file TerminalScreen.cpp
+ * @brief Implementation of the differential terminal front end
+ * @author ayrto
+ * @date 2025
+ */
+
+#include "TerminalScreen.h"
+
+#include <charconv>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr std::string_view EnterAlternate = "\033[?1049h"; ///< Switch to the alternate screen buffer
+    constexpr std::string_view LeaveAlternate = "\033[?1049l"; ///< Back to the normal screen buffer
+    constexpr std::string_view ClearScreen = "\033[H\033[2J";  ///< Cursor home, erase everything
+    constexpr std::string_view ClearBelow = "\033[J";          ///< Erase from the cursor to the end of the screen
+    constexpr int PromptLines = 15;                            ///< Lines used below the board by the prompt and a warning
+}
+
+// * Internals
+void TerminalScreen::appendMoveTo(int line, int column)
+{
+    char digits[16];
+    commands += "\033[";
+    commands.append(digits, std::to_chars(digits, digits + sizeof digits, line).ptr);
+    commands += ';';
+    commands.append(digits, std::to_chars(digits, digits + sizeof digits, column).ptr);
+    commands += 'H';
+}
+
+void TerminalScreen::appendFullFrame(const Board &board)
+{
+    commands += ClearScreen;
+    commands += renderer.render(board);
+}
+
+void TerminalScreen::appendPromptArea(const Board &board)
+{
+    // Header, top border, cells and bottom border take rows + 3 lines
+    appendMoveTo(board.getRows() + 4, 1);
+    commands += ClearBelow;
+}
+
+void TerminalScreen::flush()
+{
+    out.write(commands.data(), static_cast<std::streamsize>(commands.size()));
+    out.flush();
+    commands.clear();
+}
+
+bool TerminalScreen::fitsTerminal(const Board &board)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    winsize size{};
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_row > 0)
+        return board.getRows() + 3 + PromptLines <= size.ws_row &&
+               BoardRenderer::labelWidth(board.getRows()) + 7 + 3 * board.getColumns() <= size.ws_col;
+#endif
+    (void)board;
+    return true;
+}
+
+// * Interaction
+void TerminalScreen::show(const Board &board)
+{
+    if (!open)
+        commands += EnterAlternate;
+    open = true;
+    partial = fitsTerminal(board);
+
+    appendFullFrame(board);
+    appendPromptArea(board);
+    flush();
+}
+
+void TerminalScreen::update(const Board &board, std::span<const CellChange> changed)
+{
+    if (!partial)
+    {
+        appendFullFrame(board);
+        appendPromptArea(board);
+        flush();
+        return;
+    }
+
+    const int firstColumn = BoardRenderer::labelWidth(board.getRows()) + 5;
+    const auto columns = static_cast<std::uint32_t>(board.getColumns());
+
+    for (const auto [index, reason] : changed)
+    {
+        appendMoveTo(static_cast<int>(index / columns) + 3, firstColumn + 3 * static_cast<int>(index % columns));
+        BoardRenderer::appendCell(commands, board.getBoard()[index]);
+    }
+
+    appendPromptArea(board);
+    flush();
+}
+
+void TerminalScreen::close()
+{
+    if (!open)
+        return;
+
+    commands += LeaveAlternate;
+    flush();
+    open = false;
+}
@@ -5,61 +5,280 @@
  * @date 07/06/2025
  */
 
+#include <fstream>
 #include <iostream>
+#include <optional>
+#include <stdexcept>
 #include <string>
-#include <regex>
+#include <string_view>
+#include <vector>
 
+#include "BoardLimits.h"
+#include "BoardRenderer.h"
+#include "ChunkedBoard.h"
+#include "MappedFile.h"
 #include "Message.h"
 #include "Game.h"
+#include "MoveParser.h"
+#include "NoGuessGenerator.h"
+#include "ReplayWriter.h"
+
+namespace
+{
+    /**
+     * @brief Plays an unbounded ChunkedBoard world through a 30x16 window until a mine is revealed
+     *
+     * Moves use the usual syntax, relative to the window (A1 is its top-left cell);
+     * `up`, `down`, `left` and `right` move the window by half its size. The game
+     * starts on an empty cell near the origin, and ends on a mine or at end of input.
+     *
+     * @param seed World seed
+     */
+    void playInfinite(std::uint64_t seed)
+    {
+        constexpr int ViewColumns = 30;
+        constexpr int ViewRows = 16;
+        constexpr int MinesPerChunk = ChunkedBoard::ChunkSize * ChunkedBoard::ChunkSize / 8; // 12.5%
+
+        ChunkedBoard world(MinesPerChunk, seed);
+        BoardRenderer renderer;
+
+        // The first reveal opens an area: the first empty cell along row 0
+        std::int64_t start = 0;
+        while (!world.getCell(start, 0).isEmpty())
+            ++start;
+        world.reveal(start, 0);
+        std::int64_t left = start - ViewColumns / 2;
+        std::int64_t top = -ViewRows / 2;
+
+        std::cout << "Welcome to Minesweeper <3\n";
+        std::cout << "Infinite world (seed " << seed << "): play until you reveal a mine. Move the view with "
+                << "up, down, left and right.\n\n";
+
+        std::string line;
+        while (!world.isLost())
+        {
+            const std::string_view frame = renderer.render(world, left, top, ViewColumns, ViewRows);
+            std::cout.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+            std::cout << "View at column " << left << ", row " << top << " - " << world.getRevealedCount()
+                    << " cells revealed, " << world.getFlagCount() << " flags\n-> " << std::flush;
+            if (!std::getline(std::cin, line))
+                break;
+
+            if (line == "up" || line == "down") {
+                top += (line == "up" ? -1 : 1) * ViewRows / 2;
+                continue;
+            }
+            if (line == "left" || line == "right") {
+                left += (line == "left" ? -1 : 1) * ViewColumns / 2;
+                continue;
+            }
+
+            std::string_view text = line;
+            InputData move{};
+            MoveParser::Result result;
+            while ((result = MoveParser::next(text, move)) == MoveParser::Result::Move && !world.isLost()) {
+                if (move.column >= ViewColumns || move.row >= ViewRows) {
+                    Message::warn("That cell is outside the view");
+                    break;
+                }
+                const std::int64_t column = left + move.column;
+                const std::int64_t row = top + move.row;
+                if (move.action == 'F')
+                    world.toggleFlag(column, row);
+                else if (move.action == 'C')
+                    world.chord(column, row);
+                else
+                    world.reveal(column, row);
+            }
+            if (result == MoveParser::Result::Invalid)
+                Message::warn("Invalid move. Use e.g. 'A1', 'B5 F', 'C3 C', or up / down / left / right");
+        }
+
+        if (world.isLost()) {
+            const std::string_view frame = renderer.render(world, left, top, ViewColumns, ViewRows);
+            std::cout.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+            Message::warn("You lost the game!");
+        }
+        std::cout << "Revealed " << world.getRevealedCount() << " cells across " << world.getChunkCount()
+                << " chunks. Seed: " << seed << " (--infinite)\n";
+    }
+}
 
 /**
  * @brief Main function - handles user input for board dimensions and starts the game
+ *
+ * Accepts optional arguments:
+ * - `--seed N`: the same seed and dimensions always produce the same board
+ * - `--max-size N`: largest accepted number of columns or rows (default 10000; boards are also capped at BoardLimits::MaxCells cells)
+ * - `--no-guess`: generate a board the solver clears from the centre cell without
+ *   guessing; that cell is opened before the first move (the seed then names the search)
+ * - `--record FILE`: stream every move to a binary replay (play it back with the replay tool)
+ * - `--save FILE`: when input ends (Ctrl+D) the game is kept and written to FILE instead of lost
+ * - `--resume FILE`: continue a game written by `--save`, skipping the size prompt
+ * - `--infinite`: play an unbounded world generated in chunks as it is explored
+ *
  * @return 0 on success, 1 on error
  */
-int main() {
+int main(int argc, char *argv[]) {
+    // Frames are written in one call; without stdio sync std::cout hands them to the OS directly
+    std::ios::sync_with_stdio(false);
+
+    std::optional<std::uint64_t> seed;
+    BoardLimits limits;
+    bool noGuess = false;
+    bool infinite = false;
+    std::string recordPath;
+    std::string savePath;
+    std::string resumePath;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view argument(argv[i]);
+        if (argument == "--no-guess") {
+            noGuess = true;
+            continue;
+        }
+        if (argument == "--infinite") {
+            infinite = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+            break;
+
+        if (argument == "--record") {
+            recordPath = argv[++i];
+            continue;
+        }
+        if (argument == "--save") {
+            savePath = argv[++i];
+            continue;
+        }
+        if (argument == "--resume") {
+            resumePath = argv[++i];
+            continue;
+        }
+
+        try {
+            if (argument == "--seed") {
+                seed = std::stoull(argv[++i]);
+            } else if (argument == "--max-size") {
+                limits.maxSize = std::stoi(argv[++i]);
+            }
+        } catch (const std::exception &) {
+            Message::warn("Invalid value for " + std::string(argument) + ", expected a number");
+            return 1;
+        }
+    }
+
+    // Saves are written in one call from a buffer of their final size
+    const auto saveGame = [&](const Game &game) {
+        if (savePath.empty() || !game.isPlaying())
+            return;
+        const std::vector<std::uint8_t> bytes = game.save();
+        std::ofstream out(savePath, std::ios::binary | std::ios::trunc);
+        if (!out.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+            throw std::runtime_error("cannot write " + savePath);
+        std::cout << "Saved to " << savePath << " (resume with --resume)\n";
+    };
+
+    if (!resumePath.empty()) {
+        try {
+            // The file is mapped and block-copied into the board, however large it is
+            Game minesweeper = [&] {
+                const MappedFile file(resumePath);
+                return Game::load(file.bytes());
+            }();
+            if (!limits.accepts(minesweeper.getColumns(), minesweeper.getRows())) {
+                Message::warn("The saved board is larger than --max-size");
+                return 1;
+            }
+            if (!recordPath.empty())
+                Message::warn("--record is ignored when resuming (replays start from an untouched board)");
+
+            minesweeper.start(!savePath.empty());
+            saveGame(minesweeper);
+            std::cout << "Seed: " << minesweeper.getSeed() << "\n";
+        } catch (const std::exception &e) {
+            Message::warn("Cannot resume " + resumePath + ": " + e.what());
+            return 1;
+        }
+        return 0;
+    }
+
+    if (infinite) {
+        playInfinite(seed.value_or(Board::randomSeed()));
+        return 0;
+    }
+
     // Welcome message and input prompt
     std::cout << "Welcome to Minesweeper <3\n";
     std::cout << "Select your board dimensions (e.g. 8x10):\n\n";
 
     std::string boardSize{};
+    int columns{0};
+    int rows{0};
 
-    // Regex pattern for board size validation (format: NxN or NXN)
-    std::regex boardSizeValidation{"^[0-9]+[xX][0-9]+$"};
-
-    // Input validation loop
+    // Input validation loop (format: NxN or NXN)
     while (true) {
         std::cout << "-> ";
-        std::getline(std::cin, boardSize);
-        if (std::regex_match(boardSize, boardSizeValidation))
+        if (!std::getline(std::cin, boardSize))
+            return 1;
+        if (MoveParser::parseSize(boardSize, columns, rows))
             break;
         Message::warn("Invalid format. Use 'number x number' like '10x8'");
     }
 
-    // Parse dimensions and create game with error handling
+    // Create the game with error handling
     try {
-        // Find separator position (case-insensitive)
-        size_t xPos = boardSize.find('x');
-        if (xPos == std::string::npos) {
-            xPos = boardSize.find('X');
-        }
-
-        // Parse columns and rows from input string
-        int columns{std::stoi(boardSize.substr(0, xPos))};
-        int rows{std::stoi(boardSize.substr(xPos + 1))};
-
-        // Validate board dimensions (5x5 to 15x15)
-        if (columns < 5 || rows < 5 || columns > 15 || rows > 15) {
-            Message::warn("Dimensions must be between 5x5 and 15x15");
+        // Validate board dimensions against the runtime limits
+        if (!limits.accepts(columns, rows)) {
+            Message::warn("Dimensions must be between " + std::to_string(limits.minSize) + "x" +
+                          std::to_string(limits.minSize) + " and " + std::to_string(limits.maxSize) + "x" +
+                          std::to_string(limits.maxSize) + ", with at most " +
+                          std::to_string(BoardLimits::MaxCells) + " cells");
             return 1;
         }
 
         // Calculate mine count (12.5% density for balanced gameplay)
         int mines = std::max(1, (columns * rows) / 8);
-        Game minesweeper = Game(columns, rows, mines);
-        minesweeper.start();
-    } catch (const std::invalid_argument &e) {
-        Message::warn("Error: Invalid numbers in dimensions");
-        return 1;
+        const std::uint64_t baseSeed = seed.value_or(Board::randomSeed());
+
+        // The replay header describes the untouched board, so recording starts before any move
+        std::ofstream recordFile;
+        std::optional<ReplayWriter> recorder;
+        const auto startRecording = [&](Game &game) {
+            if (recordPath.empty())
+                return;
+            recordFile.open(recordPath, std::ios::binary | std::ios::trunc);
+            if (!recordFile)
+                throw std::runtime_error("cannot write " + recordPath);
+            recorder.emplace(recordFile, game);
+            game.setRecorder(&*recorder);
+        };
+
+        if (!noGuess) {
+            Game minesweeper = Game(columns, rows, mines, baseSeed);
+            startRecording(minesweeper);
+            minesweeper.start(!savePath.empty());
+            saveGame(minesweeper);
+            std::cout << "Seed: " << baseSeed << "\n";
+            return 0;
+        }
+
+        const int startColumn = columns / 2;
+        const int startRow = rows / 2;
+        const NoGuessGenerator generator(columns, rows, mines, startColumn, startRow);
+        const NoGuessGenerator::Result found =
+                generator.generate(baseSeed, NoGuessGenerator::defaultAttempts(columns, rows));
+        Game minesweeper = Game(columns, rows, mines, found.found ? found.seed : baseSeed, startColumn, startRow);
+        startRecording(minesweeper);
+        minesweeper.play(startColumn, startRow, 'R');
+        minesweeper.checkWinCondition();
+        minesweeper.start(!savePath.empty());
+        saveGame(minesweeper);
+        std::cout << "Seed: " << baseSeed << " (--no-guess)\n";
+        if (!found.found)
+            Message::warn("No guess-free board was found for this seed; the board may have needed a guess");
     } catch (const std::exception &e) {
         Message::warn("Unexpected error: " + std::string(e.what()));
         return 1;
@@ -0,0 +1,192 @@
+/**
+ * @file replay.cpp
+ * @brief Plays back a binary replay, headless at engine speed or step by step on the terminal
+ * @author ayrto
+ * @date 2025
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Game.h"
+#include "Message.h"
+#include "ReplayReader.h"
+#include "TerminalScreen.h"
+
+namespace
+{
+    /**
+     * @brief Parameters of a playback run
+     */
+    struct Options
+    {
+        std::string path;
+        std::uint64_t repeat{1};
+        bool step{false};
+        bool realtime{false};
+        int delayMs{200};
+    };
+
+    /**
+     * @brief What one playback went through
+     */
+    struct Playback
+    {
+        std::uint64_t records{0};    ///< Records decoded
+        std::uint64_t recordedMs{0}; ///< Sum of the recorded time deltas
+    };
+
+    // Undo / redo records go through the journal; moves through playBatch(), which skips them once the game ended
+    void applyRecord(Game &game, const ReplayFormat::Record &record)
+    {
+        if (record.move.action == 'U')
+            game.undo();
+        else if (record.move.action == 'Y')
+            game.redo();
+        else
+            game.playBatch(std::span(&record.move, 1), {});
+    }
+
+    // Runs of moves between undo / redo records are handed to playBatch() in one call
+    Playback playHeadless(ReplayReader &reader, Game &game, std::vector<InputData> &pending)
+    {
+        Playback playback;
+        ReplayFormat::Record record{};
+        pending.clear();
+
+        while (reader.next(record)) {
+            ++playback.records;
+            playback.recordedMs += record.elapsedMs;
+
+            if (record.move.action != 'U' && record.move.action != 'Y') {
+                pending.push_back(record.move);
+                continue;
+            }
+
+            game.playBatch(pending, {});
+            pending.clear();
+            applyRecord(game, record);
+        }
+
+        game.playBatch(pending, {});
+        return playback;
+    }
+
+    // One record at a time, redrawing the cells each one changed
+    Playback playStepped(ReplayReader &reader, Game &game, const Options &options)
+    {
+        Playback playback;
+        ReplayFormat::Record record{};
+        TerminalScreen screen;
+        screen.show(game.getBoard());
+
+        while (reader.next(record)) {
+            const int wait = options.realtime ? static_cast<int>(record.elapsedMs) : options.delayMs;
+            std::this_thread::sleep_for(std::chrono::milliseconds(wait));
+
+            ++playback.records;
+            playback.recordedMs += record.elapsedMs;
+            applyRecord(game, record);
+            screen.update(game.getBoard(), game.getChanges());
+        }
+
+        screen.close();
+        return playback;
+    }
+}
+
+/**
+ * @brief Plays back the replay named on the command line
+ *
+ * Usage: `replay FILE [options]`
+ * - `--repeat N`: play the replay N times headless and report the average speed (default 1)
+ * - `--step`: draw the board after every record instead of playing headless
+ * - `--delay MS`: pause between records in step mode (default 200)
+ * - `--realtime`: in step mode, pause as long as the player did
+ *
+ * Replays are written by `terminal --record FILE`.
+ *
+ * @return 0 on success, 1 on invalid arguments or a malformed replay
+ */
+int main(int argc, char *argv[]) {
+    std::ios::sync_with_stdio(false);
+    Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view argument(argv[i]);
+
+        try {
+            if (argument == "--step") {
+                options.step = true;
+            } else if (argument == "--realtime") {
+                options.realtime = true;
+            } else if (argument == "--repeat" && i + 1 < argc) {
+                options.repeat = std::max<std::uint64_t>(1, std::stoull(argv[++i]));
+            } else if (argument == "--delay" && i + 1 < argc) {
+                options.delayMs = std::max(0, std::stoi(argv[++i]));
+            } else if (!argument.starts_with("--") && options.path.empty()) {
+                options.path = argument;
+            } else {
+                Message::warn("Unknown argument " + std::string(argument));
+                return 1;
+            }
+        } catch (const std::exception &) {
+            Message::warn("Invalid value for " + std::string(argument));
+            return 1;
+        }
+    }
+
+    if (options.path.empty()) {
+        Message::warn("Usage: replay FILE [--repeat N] [--step] [--delay MS] [--realtime]");
+        return 1;
+    }
+
+    try {
+        ReplayReader reader = ReplayReader::fromFile(options.path);
+        const ReplayFormat::Header &header = reader.getHeader();
+
+        if (options.step) {
+            Game game = reader.createGame();
+            playStepped(reader, game, options);
+            game.print();
+            Message::warn(game.isWon() ? "Won" : game.isLost() ? "Lost" : "Unfinished");
+            return 0;
+        }
+
+        // The game and the batch buffer are built once; every repetition resets them in place
+        Game game = reader.createGame();
+        std::vector<InputData> pending;
+        Playback playback;
+        const auto begin = std::chrono::steady_clock::now();
+        for (std::uint64_t run = 0; run < options.repeat; ++run) {
+            if (run > 0) {
+                reader.rewind();
+                reader.restart(game);
+            }
+            playback = playHeadless(reader, game, pending);
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        const double played = static_cast<double>(playback.records * options.repeat);
+        std::cout << "Board:     " << header.columns << "x" << header.rows << ", " << header.mines << " mines, seed "
+                << header.seed << (header.layout.empty() ? "" : " (stored layout)") << "\n";
+        std::cout << "Records:   " << playback.records << "\n";
+        std::cout << "Result:    " << (game.isWon() ? "won" : game.isLost() ? "lost" : "unfinished") << ", "
+                << game.getRevealedCount() << "/" << game.getBoard().getSafeCellCount() << " safe cells revealed\n";
+        std::cout << "Recorded:  " << playback.recordedMs / 1000 << '.' << playback.recordedMs / 100 % 10 << "s\n";
+        std::cout << "Playback:  " << seconds * 1000.0 / static_cast<double>(options.repeat) << " ms per run, "
+                << (seconds > 0 ? played / seconds : played) << " records/s\n";
+    } catch (const std::exception &e) {
+        Message::warn("Cannot play " + options.path + ": " + e.what());
+        return 1;
+    }
+
+    return 0;
+}
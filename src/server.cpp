@@ -0,0 +1,578 @@
+/**
+ * @file server.cpp
+ * @brief Headless game server: many sessions over a Unix domain socket or stdin/stdout
+ * @author ayrto
+ * @date 2025
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "Message.h"
+#include "SessionManager.h"
+
+namespace
+{
+    /**
+     * @brief Parameters of the server
+     */
+    struct Options
+    {
+        std::string socketPath; ///< Empty: serve one client on stdin/stdout
+        unsigned threads{0};
+        BoardLimits limits;
+        std::size_t maxSessions{1'000'000};
+        std::size_t maxCells{std::size_t{1} << 28};
+    };
+
+    constexpr std::size_t ReadChunk = 64 * 1024;             ///< Bytes read per read() call
+    constexpr std::size_t MaxLineLength = 16 * 1024 * 1024;  ///< Longer requests close the connection
+    constexpr std::size_t MaxBufferedOutput = 4 * 1024 * 1024; ///< Reading pauses while more is unsent
+
+    constexpr std::uint64_t ListenerToken = 0; ///< epoll data of the listening socket
+    constexpr std::uint64_t WakeToken = 1;     ///< epoll data of the workers' eventfd
+
+    volatile std::sig_atomic_t stopRequested = 0;
+
+    /**
+     * @brief One client: its byte streams and the requests it has in flight
+     *
+     * The event loop owns everything but `requests`, `responses` and
+     * `owned` while a worker holds the connection (`busy`); the job queues'
+     * mutexes order the hand-over in both directions.
+     */
+    struct Connection
+    {
+        std::uint64_t token{0};             ///< epoll data identifying the connection
+        int in{-1};                         ///< Read side (the socket, or stdin)
+        int out{-1};                        ///< Write side (the socket, or stdout)
+        bool socket{false};                 ///< in == out, non-blocking, closed with the connection
+        bool pollable{true};                ///< epoll watches `in` (false for regular files on stdin)
+        bool inputClosed{false};            ///< End of input seen
+        bool busy{false};                   ///< A worker is running its requests
+        std::uint32_t watched{0};           ///< epoll events currently registered
+        std::string input;                  ///< Bytes read after the last complete line
+        std::string pending;                ///< Complete lines not yet handed to a worker
+        std::string requests;               ///< Lines being run by a worker
+        std::string responses;              ///< Responses of those lines
+        std::string output;                 ///< Responses not yet written
+        std::size_t written{0};             ///< Bytes of output already written
+        std::vector<std::uint32_t> owned;   ///< Sessions this client created, closed when it leaves
+    };
+
+    /**
+     * @brief Worker threads running the requests of one connection at a time
+     *
+     * A connection is queued only while it is not busy, so its requests run
+     * in order and its responses come back in order; different connections
+     * run in parallel. Finished connections are handed back to the event
+     * loop through `done` and an eventfd.
+     */
+    class WorkerPool
+    {
+    private:
+        SessionManager &manager;
+        int wakeFd;
+        std::mutex lock;
+        std::condition_variable ready;
+        std::deque<Connection *> jobs;
+        std::vector<Connection *> done;
+        bool stopping{false};
+        std::vector<std::thread> threads;
+
+        void run()
+        {
+            while (true)
+            {
+                Connection *connection = nullptr;
+                {
+                    std::unique_lock guard(lock);
+                    ready.wait(guard, [this] { return stopping || !jobs.empty(); });
+                    if (jobs.empty())
+                        return;
+                    connection = jobs.front();
+                    jobs.pop_front();
+                }
+
+                std::string_view requests = connection->requests;
+                while (!requests.empty())
+                {
+                    const std::size_t end = requests.find('\n');
+                    manager.handle(requests.substr(0, end), connection->responses, connection->owned);
+                    requests.remove_prefix(end + 1);
+                }
+
+                {
+                    std::scoped_lock guard(lock);
+                    done.push_back(connection);
+                }
+                const std::uint64_t one = 1;
+                [[maybe_unused]] const ssize_t ignored = ::write(wakeFd, &one, sizeof(one));
+            }
+        }
+
+    public:
+        WorkerPool(SessionManager &manager, int wakeFd, unsigned count) : manager(manager), wakeFd(wakeFd)
+        {
+            for (unsigned t = 0; t < count; ++t)
+                threads.emplace_back(&WorkerPool::run, this);
+        }
+
+        ~WorkerPool() { stop(); }
+
+        /**
+         * @brief Lets the workers finish the queued jobs and joins them (later calls do nothing)
+         */
+        void stop()
+        {
+            {
+                std::scoped_lock guard(lock);
+                stopping = true;
+            }
+            ready.notify_all();
+            for (std::thread &thread : threads)
+                thread.join();
+            threads.clear();
+        }
+
+        void submit(Connection *connection)
+        {
+            {
+                std::scoped_lock guard(lock);
+                jobs.push_back(connection);
+            }
+            ready.notify_one();
+        }
+
+        void collect(std::vector<Connection *> &finished)
+        {
+            std::scoped_lock guard(lock);
+            finished.swap(done);
+        }
+    };
+
+    /**
+     * @brief Single-threaded epoll loop: accepts, reads, frames lines and writes responses
+     */
+    class EventLoop
+    {
+    private:
+        SessionManager &manager;
+        int epollFd{-1};
+        int wakeFd{-1};
+        int listenFd{-1};
+        std::unordered_map<std::uint64_t, std::unique_ptr<Connection>> connections;
+        std::uint64_t nextToken{WakeToken + 1};
+        std::vector<Connection *> finished;
+        WorkerPool pool; ///< Last member: its threads finish their jobs before the connections go away
+
+        // Reading pauses while the client leaves many responses (or requests) waiting
+        static bool wantsInput(const Connection &connection)
+        {
+            return !connection.inputClosed &&
+                   connection.output.size() - connection.written + connection.pending.size() < MaxBufferedOutput;
+        }
+
+        Connection &add(std::unique_ptr<Connection> connection)
+        {
+            connection->token = nextToken++;
+            Connection &added = *connection;
+            connections.emplace(added.token, std::move(connection));
+            return added;
+        }
+
+        void watch(Connection &connection)
+        {
+            if (!connection.pollable)
+                return;
+
+            std::uint32_t events = 0;
+            if (wantsInput(connection))
+                events |= EPOLLIN;
+            if (connection.socket && connection.written < connection.output.size())
+                events |= EPOLLOUT;
+            if (events == connection.watched)
+                return;
+
+            // Hang-ups are reported even without events, so an idle descriptor leaves the set
+            if (events == 0)
+            {
+                ::epoll_ctl(epollFd, EPOLL_CTL_DEL, connection.in, nullptr);
+                connection.watched = 0;
+                return;
+            }
+
+            epoll_event event{};
+            event.events = events;
+            event.data.u64 = connection.token;
+            ::epoll_ctl(epollFd, connection.watched ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, connection.in, &event);
+            connection.watched = events;
+        }
+
+        void dispatch(Connection &connection)
+        {
+            if (connection.busy || connection.pending.empty())
+                return;
+
+            connection.requests.clear();
+            connection.requests.swap(connection.pending);
+            connection.busy = true;
+            pool.submit(&connection);
+        }
+
+        // Frames complete lines out of the bytes read so far
+        bool frame(Connection &connection)
+        {
+            const std::size_t end = connection.input.rfind('\n');
+            if (end == std::string::npos)
+                return connection.input.size() <= MaxLineLength;
+
+            connection.pending.append(connection.input, 0, end + 1);
+            connection.input.erase(0, end + 1);
+            return true;
+        }
+
+        void readFrom(Connection &connection)
+        {
+            char buffer[ReadChunk];
+            while (true)
+            {
+                const ssize_t count = ::read(connection.in, buffer, sizeof(buffer));
+                if (count > 0)
+                {
+                    connection.input.append(buffer, static_cast<std::size_t>(count));
+                    // A regular file is read one chunk per loop turn so responses keep flowing
+                    if (!connection.socket)
+                        break;
+                    continue;
+                }
+                if (count < 0 && errno == EINTR)
+                    continue;
+                if (count < 0 && errno == EAGAIN)
+                    break;
+
+                // End of input (or an error): a last line without '\n' still counts
+                connection.inputClosed = true;
+                if (!connection.input.empty())
+                    connection.input += '\n';
+                break;
+            }
+
+            if (!frame(connection))
+            {
+                connection.output += "ERR request too long\n";
+                connection.inputClosed = true;
+                connection.pending.clear();
+            }
+            dispatch(connection);
+        }
+
+        void writeTo(Connection &connection)
+        {
+            while (connection.written < connection.output.size())
+            {
+                const ssize_t count = ::write(connection.out, connection.output.data() + connection.written,
+                                              connection.output.size() - connection.written);
+                if (count > 0)
+                {
+                    connection.written += static_cast<std::size_t>(count);
+                    continue;
+                }
+                if (count < 0 && errno == EINTR)
+                    continue;
+                if (count < 0 && errno == EAGAIN)
+                    return;
+
+                // The client is gone: drop what it would have received
+                connection.inputClosed = true;
+                connection.pending.clear();
+                connection.output.clear();
+                connection.written = 0;
+                return;
+            }
+
+            connection.output.clear();
+            connection.written = 0;
+        }
+
+        // Returns false once the connection was destroyed
+        bool settle(Connection &connection)
+        {
+            if (connection.inputClosed && !connection.busy && connection.pending.empty() &&
+                connection.written == connection.output.size())
+            {
+                manager.close(connection.owned);
+                if (connection.watched)
+                    ::epoll_ctl(epollFd, EPOLL_CTL_DEL, connection.in, nullptr);
+                if (connection.socket)
+                    ::close(connection.in);
+                connections.erase(connection.token);
+                return false;
+            }
+
+            watch(connection);
+            return true;
+        }
+
+        void accept()
+        {
+            while (true)
+            {
+                const int fd = ::accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                if (fd < 0)
+                    return;
+
+                auto connection = std::make_unique<Connection>();
+                connection->in = connection->out = fd;
+                connection->socket = true;
+                watch(add(std::move(connection)));
+            }
+        }
+
+        void finish()
+        {
+            // The counter is drained first, so a job finishing meanwhile wakes the loop again
+            std::uint64_t count = 0;
+            [[maybe_unused]] const ssize_t ignored = ::read(wakeFd, &count, sizeof(count));
+
+            pool.collect(finished);
+            for (Connection *connection : finished)
+            {
+                connection->busy = false;
+                connection->output += connection->responses;
+                connection->responses.clear();
+                writeTo(*connection);
+                dispatch(*connection);
+                settle(*connection);
+            }
+            finished.clear();
+        }
+
+    public:
+        EventLoop(SessionManager &manager, int listenFd, unsigned threads)
+            : manager(manager), epollFd(::epoll_create1(EPOLL_CLOEXEC)),
+              wakeFd(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)), listenFd(listenFd), pool(manager, wakeFd, threads)
+        {
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.u64 = WakeToken;
+            ::epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+
+            if (listenFd >= 0)
+            {
+                event.data.u64 = ListenerToken;
+                ::epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event);
+            }
+        }
+
+        ~EventLoop()
+        {
+            // Workers signal wakeFd after each job, so they must be gone before it is closed (and maybe reused)
+            pool.stop();
+            ::close(epollFd);
+            ::close(wakeFd);
+        }
+
+        EventLoop(const EventLoop &) = delete;
+        EventLoop &operator=(const EventLoop &) = delete;
+
+        /**
+         * @brief Serves stdin / stdout as one more client (regular files are read without epoll)
+         */
+        void addStdio()
+        {
+            auto connection = std::make_unique<Connection>();
+            connection->in = STDIN_FILENO;
+            connection->out = STDOUT_FILENO;
+            Connection &added = add(std::move(connection));
+
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.u64 = added.token;
+            if (::epoll_ctl(epollFd, EPOLL_CTL_ADD, STDIN_FILENO, &event) == 0)
+                added.watched = EPOLLIN;
+            else
+                added.pollable = false;
+        }
+
+        /**
+         * @brief Runs until a signal asks to stop, or (without a socket) until stdin is done
+         */
+        void run()
+        {
+            std::vector<epoll_event> events(256);
+
+            while (!stopRequested && (listenFd >= 0 || !connections.empty()))
+            {
+                // Unpollable input is always ready; the loop then only peeks at the other events.
+                // It is remembered by token: the events below may destroy the connection
+                std::uint64_t file = 0;
+                for (auto &[token, connection] : connections)
+                    if (!connection->pollable && wantsInput(*connection))
+                        file = token;
+
+                const int count = ::epoll_wait(epollFd, events.data(), static_cast<int>(events.size()),
+                                               file ? 0 : -1);
+                if (count < 0 && errno != EINTR)
+                    break;
+
+                for (int i = 0; i < count; ++i)
+                {
+                    const std::uint64_t token = events[i].data.u64;
+                    if (token == ListenerToken)
+                    {
+                        accept();
+                        continue;
+                    }
+                    if (token == WakeToken)
+                    {
+                        finish();
+                        continue;
+                    }
+
+                    const auto it = connections.find(token);
+                    if (it == connections.end())
+                        continue;
+
+                    Connection &connection = *it->second;
+                    if (events[i].events & EPOLLOUT)
+                        writeTo(connection);
+                    if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+                        readFrom(connection);
+                    settle(connection);
+                }
+
+                const auto it = file ? connections.find(file) : connections.end();
+                if (it != connections.end() && wantsInput(*it->second))
+                {
+                    Connection &connection = *it->second;
+                    readFrom(connection);
+                    settle(connection);
+                }
+            }
+        }
+    };
+
+    int listenOn(const std::string &path)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path))
+            throw std::runtime_error("socket path too long");
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+        const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0)
+            throw std::runtime_error("cannot create a socket");
+
+        // A stale socket file from an earlier run would make bind() fail
+        ::unlink(path.c_str());
+        if (::bind(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0 ||
+            ::listen(fd, SOMAXCONN) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("cannot listen on " + path + ": " + std::strerror(errno));
+        }
+        return fd;
+    }
+
+    void requestStop(int) { stopRequested = 1; }
+}
+
+/**
+ * @brief Hosts games for bots and players over a line protocol (see SessionManager.h)
+ *
+ * Accepted arguments (all optional):
+ * - `--socket PATH`: listen on a Unix domain socket (default: serve stdin / stdout and stop at its end)
+ * - `--threads N`: worker threads (default: one per hardware thread)
+ * - `--max-size N`: largest accepted number of columns or rows (default 10000)
+ * - `--max-sessions N`: games open at once (default 1000000)
+ * - `--max-cells N`: total cells of the games open at once (default 268435456)
+ *
+ * Games a client creates are closed when it disconnects.
+ *
+ * @return 0 on success, 1 on invalid arguments or if the socket cannot be opened
+ */
+int main(int argc, char *argv[]) {
+    Options options;
+
+    for (int i = 1; i < argc; i += 2) {
+        const std::string_view argument(argv[i]);
+        if (i + 1 >= argc) {
+            Message::warn("Missing value for " + std::string(argument));
+            return 1;
+        }
+        const std::string value(argv[i + 1]);
+
+        try {
+            if (argument == "--socket") {
+                options.socketPath = value;
+            } else if (argument == "--threads") {
+                options.threads = static_cast<unsigned>(std::stoul(value));
+            } else if (argument == "--max-size") {
+                options.limits.maxSize = std::stoi(value);
+            } else if (argument == "--max-sessions") {
+                options.maxSessions = std::stoull(value);
+            } else if (argument == "--max-cells") {
+                options.maxCells = std::stoull(value);
+            } else {
+                Message::warn("Unknown argument " + std::string(argument));
+                return 1;
+            }
+        } catch (const std::exception &) {
+            Message::warn("Invalid value for " + std::string(argument));
+            return 1;
+        }
+    }
+
+    if (options.threads == 0)
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::signal(SIGPIPE, SIG_IGN);
+    std::signal(SIGINT, requestStop);
+    std::signal(SIGTERM, requestStop);
+
+    try {
+        SessionManager manager(options.limits, options.maxSessions, options.maxCells);
+        const int listenFd = options.socketPath.empty() ? -1 : listenOn(options.socketPath);
+
+        {
+            EventLoop loop(manager, listenFd, options.threads);
+            if (listenFd < 0)
+                loop.addStdio();
+            else
+                std::cerr << "Listening on " << options.socketPath << " with " << options.threads << " workers\n";
+            loop.run();
+        }
+
+        if (listenFd >= 0) {
+            ::close(listenFd);
+            ::unlink(options.socketPath.c_str());
+        }
+    } catch (const std::exception &e) {
+        Message::warn("Server error: " + std::string(e.what()));
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+/**
+ * @file simulate.cpp
+ * @brief Headless Monte Carlo harness: plays many seeded games with a bot and reports statistics
+ * @author ayrto
+ * @date 2025
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Bot.h"
+#include "Game.h"
+#include "Message.h"
+#include "MoveParser.h"
+#include "NoGuessGenerator.h"
+
+namespace
+{
+    /**
+     * @brief Parameters of a simulation run
+     */
+    struct Options
+    {
+        int columns{30};
+        int rows{16};
+        int mines{99};
+        std::uint64_t games{100000};
+        std::uint64_t seed{1};
+        unsigned threads{0};
+        Bot::Strategy strategy{Bot::Strategy::Solver};
+    };
+
+    /**
+     * @brief Game numbers still owned by one worker; other workers steal from its back half
+     */
+    struct alignas(64) WorkQueue
+    {
+        std::mutex lock;
+        std::uint64_t next{0};
+        std::uint64_t end{0};
+    };
+
+    /**
+     * @brief Counters gathered by one worker
+     */
+    struct alignas(64) Totals
+    {
+        std::uint64_t games{0};
+        std::uint64_t wins{0};
+        std::uint64_t moves{0};
+    };
+
+    constexpr std::uint64_t BatchSize = 32; ///< Games claimed from the own queue at once
+
+    // Takes up to BatchSize games from the front of a queue
+    bool claim(WorkQueue &queue, std::uint64_t &first, std::uint64_t &last)
+    {
+        std::scoped_lock guard(queue.lock);
+        if (queue.next == queue.end)
+            return false;
+
+        first = queue.next;
+        last = std::min(queue.end, first + BatchSize);
+        queue.next = last;
+        return true;
+    }
+
+    // Moves the back half of the fullest other queue into the thief's (empty) queue
+    bool steal(std::vector<WorkQueue> &queues, std::size_t thief)
+    {
+        for (std::size_t offset = 1; offset < queues.size(); ++offset)
+        {
+            WorkQueue &victim = queues[(thief + offset) % queues.size()];
+            std::uint64_t first, last;
+            {
+                std::scoped_lock guard(victim.lock);
+                const std::uint64_t remaining = victim.end - victim.next;
+                if (remaining == 0)
+                    continue;
+
+                last = victim.end;
+                first = victim.end - (remaining + 1) / 2;
+                victim.end = first;
+            }
+
+            std::scoped_lock guard(queues[thief].lock);
+            queues[thief].next = first;
+            queues[thief].end = last;
+            return true;
+        }
+
+        return false;
+    }
+
+    void work(const Options &options, std::vector<WorkQueue> &queues, std::size_t id, Totals &totals)
+    {
+        const int startColumn = options.columns / 2;
+        const int startRow = options.rows / 2;
+
+        // One board and bot per thread, regenerated in place for every game
+        Game game(options.columns, options.rows, options.mines, options.seed, startColumn, startRow);
+        Bot bot(game, options.strategy);
+
+        std::uint64_t first, last;
+        while (claim(queues[id], first, last) || (steal(queues, id) && claim(queues[id], first, last)))
+        {
+            for (std::uint64_t number = first; number < last; ++number)
+            {
+                game.reset(NoGuessGenerator::candidateSeed(options.seed, number), startColumn, startRow);
+                bot.reset();
+                totals.moves += bot.playToEnd(startColumn, startRow);
+                totals.wins += game.isWon();
+                ++totals.games;
+            }
+        }
+    }
+
+    bool parseStrategy(std::string_view name, Bot::Strategy &strategy)
+    {
+        if (name == "random")
+            strategy = Bot::Strategy::Random;
+        else if (name == "solver")
+            strategy = Bot::Strategy::Solver;
+        else if (name == "probability")
+            strategy = Bot::Strategy::Probability;
+        else
+            return false;
+        return true;
+    }
+}
+
+/**
+ * @brief Runs the simulation described by the command line
+ *
+ * Accepted arguments (all optional):
+ * - `--games N`: number of games (default 100000)
+ * - `--size CxR`: board dimensions (default 30x16)
+ * - `--mines N`: mines per board (default 99)
+ * - `--bot random|solver|probability`: move selection (default solver)
+ * - `--seed N`: base seed; game i uses the i-th seed derived from it (default 1)
+ * - `--threads N`: worker threads (default: one per hardware thread)
+ *
+ * Every game starts by revealing the centre cell, which is never a mine.
+ *
+ * @return 0 on success, 1 on invalid arguments
+ */
+int main(int argc, char *argv[]) {
+    Options options;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string_view argument(argv[i]);
+        const std::string value(argv[i + 1]);
+
+        try {
+            if (argument == "--games") {
+                options.games = std::stoull(value);
+            } else if (argument == "--size") {
+                // Same CxR syntax as the interactive prompt; "30" alone is not a size
+                if (!MoveParser::parseSize(value, options.columns, options.rows))
+                    throw std::invalid_argument(value);
+            } else if (argument == "--mines") {
+                options.mines = std::stoi(value);
+            } else if (argument == "--seed") {
+                options.seed = std::stoull(value);
+            } else if (argument == "--threads") {
+                options.threads = static_cast<unsigned>(std::stoul(value));
+            } else if (argument == "--bot") {
+                if (!parseStrategy(value, options.strategy))
+                    throw std::invalid_argument(value);
+            } else {
+                Message::warn("Unknown argument " + std::string(argument));
+                return 1;
+            }
+        } catch (const std::exception &) {
+            Message::warn("Invalid value for " + std::string(argument));
+            return 1;
+        }
+    }
+
+    if (options.columns < 3 || options.rows < 3 || options.mines < 0) {
+        Message::warn("Boards need at least 3x3 cells and a non-negative mine count");
+        return 1;
+    }
+
+    if (options.threads == 0)
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // Contiguous initial shares; workers that run dry steal half of someone else's remainder
+    std::vector<WorkQueue> queues(options.threads);
+    for (unsigned t = 0; t < options.threads; ++t) {
+        queues[t].next = options.games * t / options.threads;
+        queues[t].end = options.games * (t + 1) / options.threads;
+    }
+    std::vector<Totals> totals(options.threads);
+
+    const auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < options.threads; ++t)
+        pool.emplace_back(work, std::cref(options), std::ref(queues), t, std::ref(totals[t]));
+    work(options, queues, 0, totals[0]);
+    for (std::thread &thread : pool)
+        thread.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    Totals sum;
+    for (const Totals &part : totals) {
+        sum.games += part.games;
+        sum.wins += part.wins;
+        sum.moves += part.moves;
+    }
+
+    const double games = static_cast<double>(std::max<std::uint64_t>(sum.games, 1));
+    std::cout << "Board:         " << options.columns << "x" << options.rows << ", " << options.mines << " mines\n";
+    std::cout << "Games:         " << sum.games << " on " << options.threads << " threads\n";
+    std::cout << "Win rate:      " << 100.0 * static_cast<double>(sum.wins) / games << " %\n";
+    std::cout << "Average moves: " << static_cast<double>(sum.moves) / games << "\n";
+    std::cout << "Games/second:  " << static_cast<double>(sum.games) / seconds << "\n";
+    return 0;
+}
@@ -15,65 +15,146 @@
 #include <string>
 #include <iostream>
 #include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
 
+#include "BoardLimits.h"
 #include "Game.h"
+#include "GamePool.h"
+#include "GameStatus.h"
 #include "Message.h"
+#include "NoGuessGenerator.h"
 
 /**
- * @brief Owning pointer to the active Game instance for the web session.
+ * @brief Recycles the previous game's storage when js_init() starts one of the same size.
+ *        Declared before g_game so it outlives it.
+ */
+static GamePool g_pool;
+
+/**
+ * @brief Lease on the active Game instance for the web session (empty before js_init()).
  *        A single instance model keeps the interop surface minimal.
  */
-static Game *g_game = nullptr;
+static GamePool::Lease g_game;
+
+/**
+ * @brief Size limits applied by js_init; adjustable at runtime with js_set_max_size().
+ */
+static BoardLimits g_limits;
+
+/**
+ * @brief Bytes of the last js_save(), kept until the next one so JavaScript can copy them out.
+ */
+static std::vector<std::uint8_t> g_save;
+
+// js_submit_batch reads moves straight from an Int32Array: [column, row, action char code] per move
+static_assert(sizeof(InputData) == 3 * sizeof(std::int32_t) && offsetof(InputData, row) == 4 &&
+              offsetof(InputData, action) == 8, "InputData must match the JS batch layout");
+
+// js_view_ptr hands out the board's own cell buffer: one packed byte per cell, see Cell.h
+static_assert(sizeof(Cell) == 1, "The JS board view reads one byte per cell");
+
+/**
+ * @brief Print the win / lose message if the active game has ended.
+ */
+static void announceEnd() {
+    if (g_game->isLost()) {
+        Message::warn("You lost the game!");
+    } else if (g_game->isWon()) {
+        Message::warn("You won the game!");
+    }
+}
 
 extern "C" {
 /**
  * @brief Initialize (or re-initialize) the game from JavaScript.
- * @param columns Requested number of columns (will be clamped to [5,15]).
- * @param rows Requested number of rows (will be clamped to [5,15]).
+ * @param columns Requested number of columns (will be clamped to the configured limits).
+ * @param rows Requested number of rows (will be clamped to the configured limits).
+ * @param seed Seed of the mine layout as a decimal string (the full 64-bit range, like the
+ *             native version), or "0" / "" for a random board. The seed in use is printed
+ *             so that any board can be regenerated.
+ * @param noGuess Non-zero to search for a board the solver clears from the centre cell
+ *                without guessing; that cell is opened right away. The printed seed then
+ *                names the search, so the same seed with noGuess reproduces the board.
  *
- * Destroys any previous Game, clamps dimensions for safety / consistency with the native
- * version, computes a mine count (~12.5% density), prints a welcome header and the initial
- * board. A note is printed if the requested size was adjusted.
+ * Returns any previous Game to the pool (a new board of the same size and mine count reuses
+ * its storage), clamps dimensions for safety / consistency with the native version, computes
+ * a mine count (~12.5% density), prints a welcome header and the initial board. A note is
+ * printed if the requested size was adjusted.
  */
 EMSCRIPTEN_KEEPALIVE
-void js_init(int columns, int rows) {
-    if (g_game) {
-        // Dispose previous session if any
-        delete g_game;
-        g_game = nullptr;
-    }
+void js_init(int columns, int rows, const char *seed, int noGuess) {
+    // The previous game goes back to the pool; a board of the same size is regenerated in place
+    g_game.reset();
 
     // Backend-enforced constraints (mirrors native validation)
     int origCols = columns;
     int origRows = rows;
-    if (columns < 5) columns = 5;
-    else if (columns > 15) columns = 15;
-    if (rows < 5) rows = 5;
-    else if (rows > 15) rows = 15;
+    g_limits.clamp(columns, rows);
     bool adjusted = (origCols != columns) || (origRows != rows);
 
     int mines = std::max(1, (columns * rows) / 8); // Mine density heuristic
-    g_game = new Game(columns, rows, mines);
+    // A JS number cannot hold every 64-bit seed, so the seed arrives as text
+    std::uint64_t requestedSeed = 0;
+    const std::string_view seedText = seed ? seed : "";
+    if (!seedText.empty() &&
+        std::from_chars(seedText.data(), seedText.data() + seedText.size(), requestedSeed).ec != std::errc{}) {
+        Message::warn("Invalid seed " + std::string(seedText) + "; using a random one");
+        requestedSeed = 0;
+    }
+    const std::uint64_t baseSeed = requestedSeed != 0 ? requestedSeed : Board::randomSeed();
+    bool guessFree = false;
+
+    if (noGuess) {
+        const int startColumn = columns / 2;
+        const int startRow = rows / 2;
+        const NoGuessGenerator generator(columns, rows, mines, startColumn, startRow);
+        const NoGuessGenerator::Result found =
+                generator.generate(baseSeed, NoGuessGenerator::defaultAttempts(columns, rows));
+        guessFree = found.found;
+        g_game = g_pool.acquire(columns, rows, mines, found.found ? found.seed : baseSeed, startColumn, startRow);
+        g_game->play(startColumn, startRow, 'R');
+        g_game->checkWinCondition();
+    } else {
+        g_game = g_pool.acquire(columns, rows, mines, baseSeed);
+    }
+    g_game->enableHistory();
+
     std::cout << "Welcome to Minesweeper <3\n";
-    std::cout << "Board: " << columns << "x" << rows << " (mines: " << mines << ")\n\n";
+    std::cout << "Board: " << columns << "x" << rows << " (mines: " << mines << ", seed: " << baseSeed
+            << (guessFree ? ", no guessing needed" : "") << ")\n\n";
+    if (noGuess && !guessFree)
+        std::cout << "[No guess-free board found for this seed; the board may need a guess]" << std::endl;
     if (adjusted)
-        std::cout << "[Requested size " << origCols << "x" << origRows << " adjusted to allowed range 5..15]" <<
-                std::endl;
-    g_game->print();
-    std::cout << "\n";
+        std::cout << "[Requested size " << origCols << "x" << origRows << " adjusted to allowed range "
+                << g_limits.minSize << ".." << g_limits.maxSize << "]" << std::endl;
 }
 
 /**
- * @brief Submit a text command from JavaScript (e.g. "A1", "B5 F", "C3 R").
+ * @brief Change the largest board dimension accepted by js_init().
+ * @param maxSize New upper limit for columns and rows (ignored if below the minimum).
+ */
+EMSCRIPTEN_KEEPALIVE
+void js_set_max_size(int maxSize) {
+    if (maxSize >= g_limits.minSize)
+        g_limits.maxSize = maxSize;
+}
+
+/**
+ * @brief Submit a text command from JavaScript (e.g. "A1", "B5 F", "C3 R", "A1 B2F 3,4").
  * @param text Null-terminated UTF-8 input string from the web UI.
  *
  * Steps:
  *  1. Validate game instance exists.
- *  2. Normalize to uppercase for uniform parsing.
- *  3. Validate syntax using Game::isValidInput().
- *  4. Parse (column,row,action) and apply the move.
- *  5. Check win condition, clear screen, re-print board.
- *  6. Emit win / lose message if terminal state reached.
+ *  2. Validate every move of the line and play them in order (Game::playLine(),
+ *     case-insensitive, stops at the end of the game).
+ *  3. Emit win / lose message if terminal state reached (the page redraws the board
+ *     from js_view_ptr()).
  */
 EMSCRIPTEN_KEEPALIVE
 void js_submit(const char *text) {
@@ -83,53 +164,193 @@ void js_submit(const char *text) {
     }
     if (!text) return; // Defensive guard
 
-    std::string input(text);
-    // Normalize to uppercase (C++20 ranges variant)
-    std::ranges::transform(input, input.begin(), ::toupper);
-
-    if (!g_game->isValidInput(input)) {
-        Message::warn("Invalid format! Valid examples: A1, B3 F, C4 R");
+    if (!g_game->playLine(text)) {
+        Message::warn("Invalid format! Valid examples: A1, B3 F, C4 R, D2 C, A1 B2F");
         return;
     }
 
-    auto [column, row, action] = g_game->parseInput(input);
-    g_game->play(column, row, action);
-    g_game->checkWinCondition();
+    announceEnd();
+}
+
+/**
+ * @brief Play many moves in one call, without text parsing or per-move printing.
+ * @param moves Pointer into the WASM heap to `count` moves, each three int32 values:
+ *              0-based column, 0-based row and the action's character code ('R', 'F' or 'C').
+ * @param count Number of moves.
+ * @param outcomes Pointer into the WASM heap to `count` bytes receiving one MoveOutcome
+ *                 code per move (may be null).
+ * @return Number of moves played (fewer than count if the game ended), -1 if no game.
+ *
+ * Nothing is printed but the win / lose message. See Module.playBatch in pre.js.
+ */
+EMSCRIPTEN_KEEPALIVE
+int js_submit_batch(const InputData *moves, int count, std::uint8_t *outcomes) {
+    if (!g_game)
+        return -1;
+    if (!moves || count <= 0)
+        return 0;
+
+    const auto size = static_cast<std::size_t>(count);
+    const std::size_t played = g_game->playBatch(
+            std::span(moves, size),
+            std::span(reinterpret_cast<MoveOutcome *>(outcomes), outcomes ? size : 0));
 
-    g_game->clear();
-    g_game->print();
+    announceEnd();
 
-    if (g_game->isLost()) {
-        Message::warn("You lost the game!");
-    } else if (g_game->isWon()) {
-        Message::warn("You won the game!");
-    }
+    return static_cast<int>(played);
+}
+
+/**
+ * @brief Play one move given as integers, e.g. from a click on the canvas.
+ * @param column 0-based column.
+ * @param row 0-based row.
+ * @param action Character code of the action: 'R' (reveal), 'F' (flag) or 'C' (chord).
+ * @return MoveOutcome code of the move (see enums/MoveOutcome.h), -1 if no game.
+ *
+ * No string crosses the bridge and nothing is parsed: the move goes straight to
+ * Game::playBatch(), which validates the coordinates and action. The changed cells are
+ * then available through js_changes_ptr(). The win / lose message is printed by the move
+ * that ends the game.
+ */
+EMSCRIPTEN_KEEPALIVE
+int js_play(int column, int row, int action) {
+    if (!g_game)
+        return -1;
+
+    const InputData move{column, row, static_cast<char>(action)};
+    MoveOutcome outcome = MoveOutcome::Skipped;
+    g_game->playBatch(std::span(&move, 1), std::span(&outcome, 1));
+
+    if (outcome != MoveOutcome::Skipped)
+        announceEnd();
+    return static_cast<int>(outcome);
 }
 
-/** @brief Return active board column count (0 if no game). */
+/**
+ * @brief Chord a number: reveal its unflagged neighbours once all its mines are flagged.
+ * @param column 0-based column of the number.
+ * @param row 0-based row of the number.
+ * @return MoveOutcome code of the move, -1 if no game. Same as js_play(column, row, 'C').
+ */
 EMSCRIPTEN_KEEPALIVE
-int js_status_columns() { return g_game ? g_game->getColumns() : 0; }
+int js_chord(int column, int row) { return js_play(column, row, 'C'); }
 
-/** @brief Return active board row count (0 if no game). */
+/**
+ * @brief Return the address of the board's cell buffer inside the WASM heap (0 if no game).
+ *
+ * The buffer is the Board's own storage, so reading it costs no copy and no formatting:
+ * `new Uint8Array(Module.HEAPU8.buffer, js_view_ptr(), js_view_stride() * rows)`, with rows from js_status().
+ * Cells are row-major, one byte each (see Cell.h):
+ *  - bits 0-3: nearby mine count (0-8)
+ *  - bits 4-5: state (0 = hidden, 1 = revealed, 2 = flagged)
+ *  - bits 6-7: content (0 = empty, 1 = number, 2 = mine)
+ *
+ * The address changes when js_init() creates a new game, and the heap's ArrayBuffer is
+ * replaced when memory grows, so the view should be re-created for every frame.
+ */
 EMSCRIPTEN_KEEPALIVE
-int js_status_rows() { return g_game ? g_game->getRows() : 0; }
+std::uintptr_t js_view_ptr() {
+    return g_game ? reinterpret_cast<std::uintptr_t>(g_game->getBoard().getBoard().data()) : 0;
+}
 
-/** @brief Return total mine count (0 if no game). */
+/** @brief Return the distance in bytes between two rows of the js_view_ptr() buffer (0 if no game). */
 EMSCRIPTEN_KEEPALIVE
-int js_status_mines_total() { return g_game ? g_game->getMinesTotal() : 0; }
+int js_view_stride() { return g_game ? g_game->getColumns() : 0; }
 
-/** @brief Return number of currently placed flags. */
+/**
+ * @brief Take back the last move (practice mode); also revives a lost game.
+ * @return 1 if a move was undone, 0 if there is nothing to undo or no game.
+ *
+ * Costs O(cells the move changed); they are listed at js_changes_ptr() afterwards.
+ */
 EMSCRIPTEN_KEEPALIVE
-int js_status_flags() { return g_game ? g_game->getFlagsCount() : 0; }
+int js_undo() { return g_game && g_game->undo() ? 1 : 0; }
 
-/** @brief Return revealed safe cell count. */
+/**
+ * @brief Play the last undone move again.
+ * @return 1 if a move was redone, 0 if there is nothing to redo or no game.
+ */
 EMSCRIPTEN_KEEPALIVE
-int js_status_revealed() { return g_game ? g_game->getRevealedCount() : 0; }
+int js_redo() { return g_game && g_game->redo() ? 1 : 0; }
 
 /**
- * @brief Return current game state code.
- * @return 0 = Playing, 1 = Won, 2 = Lost, -1 = No active game.
+ * @brief Return the address of the change list of the last js_submit / js_submit_batch call.
+ *
+ * Records are 8 bytes: a uint32 cell offset (row * js_view_stride() + column) followed by a
+ * reason byte, 0 = revealed, 1 = flagged, 2 = unflagged, 3 = exploded, 4 = hidden by an undo
+ * (see CellChange.h).
+ * Valid until the next call that plays, undoes or redoes a move.
  */
 EMSCRIPTEN_KEEPALIVE
-int js_status_state() { return g_game ? g_game->getStateValue() : -1; }
+const CellChange *js_changes_ptr() { return g_game ? g_game->getChanges().data() : nullptr; }
+
+/** @brief Return the number of records at js_changes_ptr() (0 if no game). */
+EMSCRIPTEN_KEEPALIVE
+int js_changes_count() { return g_game ? static_cast<int>(g_game->getChanges().size()) : 0; }
+
+/**
+ * @brief Serialise the active game into the save format (see SaveFormat.h).
+ * @return Size of the save in bytes (0 if no game); the bytes are at js_save_ptr().
+ *
+ * The page copies them out with `Module.HEAPU8.slice(ptr, ptr + size)` and offers them
+ * as a download. The buffer is reused by the next call.
+ */
+EMSCRIPTEN_KEEPALIVE
+int js_save() {
+    g_save = g_game ? g_game->save() : std::vector<std::uint8_t>{};
+    return static_cast<int>(g_save.size());
+}
+
+/** @brief Return the address of the bytes of the last js_save(). */
+EMSCRIPTEN_KEEPALIVE
+const std::uint8_t *js_save_ptr() { return g_save.data(); }
+
+/**
+ * @brief Resume a saved game from a byte buffer in the WASM heap.
+ * @param bytes Pointer to `size` bytes written by js_save() (or by the native `--save`).
+ * @param size Number of bytes.
+ * @return 1 if the game was loaded, 0 if the data is not a valid save (the current game stays).
+ *
+ * The board is restored with block copies (Game::load()); its size is checked against the
+ * configured limits. The undo history starts empty.
+ */
+EMSCRIPTEN_KEEPALIVE
+int js_load(const std::uint8_t *bytes, int size) {
+    if (!bytes || size <= 0)
+        return 0;
+
+    try {
+        Game loaded = Game::load(std::span(bytes, static_cast<std::size_t>(size)));
+        if (!g_limits.accepts(loaded.getColumns(), loaded.getRows())) {
+            Message::warn("The saved board is larger than the allowed size");
+            return 0;
+        }
+
+        g_game = g_pool.adopt(std::move(loaded));
+    } catch (const std::exception &e) {
+        Message::warn(std::string("Cannot load the save: ") + e.what());
+        return 0;
+    }
+
+    std::cout << "Board: " << g_game->getColumns() << "x" << g_game->getRows() << " (mines: "
+            << g_game->getMinesTotal() << ", seed: " << g_game->getSeed() << ", resumed)\n\n";
+    announceEnd();
+    return 1;
+}
+
+/**
+ * @brief Fill the status struct and return its address in the WASM heap.
+ * @return Pointer to a GameStatus: ten int32 values, in order columns, rows, mines, flags,
+ *         revealed, state (0 = Playing, 1 = Won, 2 = Lost, -1 = no game), moves, elapsed
+ *         milliseconds, cells revealed by the last move and 3BV.
+ *
+ * One call replaces the former per-field getters; the page reads the result with a single
+ * `Int32Array` view. The struct is static, so the address stays the same between calls.
+ */
+EMSCRIPTEN_KEEPALIVE
+const GameStatus *js_status() {
+    static GameStatus status;
+    status = g_game ? g_game->getStatus() : GameStatus{};
+    return &status;
+}
 } // extern "C"
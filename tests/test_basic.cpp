@@ -1,8 +1,68 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
 #include "Board.h"
+#include "BoardRenderer.h"
+#include "Bot.h"
 #include "Game.h"
+#include "GamePool.h"
 #include "Cell.h"
+#include "ChunkedBoard.h"
+#include "Coordinates.h"
+#include "MappedFile.h"
+#include "MoveParser.h"
+#include "NoGuessGenerator.h"
+#include "ProbabilityEngine.h"
+#include "ReplayReader.h"
+#include "ReplayWriter.h"
+#include "SessionManager.h"
+#include "Solver.h"
+
+// Counts heap allocations and tracks the bytes in use, so tests can check that a path stays off the heap
+// or within a memory bound. Every block carries its size in front (16 bytes keep the alignment).
+static std::atomic<std::size_t> g_allocations = 0;
+static std::atomic<std::size_t> g_liveBytes = 0;
+static std::atomic<std::size_t> g_peakBytes = 0;
+
+void *operator new(std::size_t size)
+{
+    ++g_allocations;
+    auto *block = static_cast<std::max_align_t *>(std::malloc(size + sizeof(std::max_align_t)));
+    if (!block)
+        throw std::bad_alloc();
+
+    *reinterpret_cast<std::size_t *>(block) = size;
+    const std::size_t live = g_liveBytes += size;
+    std::size_t peak = g_peakBytes;
+    while (live > peak && !g_peakBytes.compare_exchange_weak(peak, live))
+    {
+    }
+    return block + 1;
+}
+
+void operator delete(void *memory) noexcept
+{
+    if (!memory)
+        return;
+    auto *block = static_cast<std::max_align_t *>(memory) - 1;
+    g_liveBytes -= *reinterpret_cast<std::size_t *>(block);
+    std::free(block);
+}
+
+void operator delete(void *memory, std::size_t) noexcept { operator delete(memory); }
 
 // Basic test to verify board creation
 void testBoardCreation()
@@ -100,6 +160,1098 @@ void testMineCount()
     std::cout << "\u2705 Mine count test passed\n";
 }
 
+// Test to verify packed cell fields do not interfere with each other
+void testPackedCell()
+{
+    static_assert(sizeof(Cell) == 1);
+
+    Cell cell(CellContent::Number, CellState::Flagged);
+    cell.setNearbyMines(8);
+    assert(cell.isFlagged() && cell.isNumber() && cell.getNearbyMines() == 8);
+
+    cell.setState(CellState::Revealed);
+    cell.setContent(CellContent::Mine);
+    assert(cell.isRevealed() && cell.isMine() && cell.getNearbyMines() == 8);
+
+    std::cout << "\u2705 Packed cell test passed\n";
+}
+
+// Test to verify mine placement and neighbour numbers on the flat grid
+void testBoardNumbers(int columns, int rows, int mineCount)
+{
+    Board board(columns, rows, mineCount);
+    int mines = 0;
+
+    for (int r = 0; r < board.getRows(); ++r)
+    {
+        for (int c = 0; c < board.getColumns(); ++c)
+        {
+            const Cell cell = board.getCell(c, r);
+            assert(&board.getBoard()[board.index(c, r)] == &board.getCell(c, r));
+
+            if (cell.isMine())
+            {
+                ++mines;
+                continue;
+            }
+
+            int expected = 0;
+            for (int dr = -1; dr <= 1; ++dr)
+                for (int dc = -1; dc <= 1; ++dc)
+                    if ((dr || dc) && board.isValidBoardCoordinate(c + dc, r + dr) && board.getCell(c + dc, r + dr).isMine())
+                        ++expected;
+
+            assert(!board.getMineLayer().test(c, r));
+            assert(cell.getNearbyMines() == expected);
+            assert(cell.isNumber() == (expected > 0));
+        }
+    }
+
+    assert(mines == mineCount);
+    std::cout << "\u2705 Board numbers test passed\n";
+}
+
+// Test to verify the iterative flood fill on a board far larger than the old recursion allowed
+void testFloodFill()
+{
+    Game game(2000, 2000, 0);
+
+    assert(game.revealCellAndPropagate(1000, 1000) == 2000 * 2000);
+    assert(game.revealCellAndPropagate(0, 0) == 0);
+    game.checkWinCondition();
+    assert(game.isWon());
+
+    std::cout << "\u2705 Flood fill test passed\n";
+}
+
+// Test to verify the running counters against a full scan of the board
+void testCounters()
+{
+    Board board(6, 6, 0);
+    board.toggleFlag(board.index(0, 0));
+    board.toggleFlag(board.index(1, 0));
+    board.toggleFlag(board.index(1, 0));
+    board.revealCell(board.index(5, 5));
+    board.revealCell(board.index(5, 5));
+    board.revealCell(board.index(0, 0)); // flagged cells are not revealed
+
+    int flags = 0, revealed = 0, hidden = 0;
+    for (const Cell &cell : board.getBoard())
+    {
+        flags += cell.isFlagged();
+        revealed += cell.isRevealed() && !cell.isMine();
+        hidden += cell.isHidden();
+    }
+
+    assert(board.getFlagCount() == flags && flags == 1);
+    assert(board.getRevealedSafeCount() == revealed && revealed == 1);
+    assert(board.getHiddenCount() == hidden && hidden == 34);
+
+    Game game(9, 9, 10);
+    game.play(0, 0, 'F');
+    game.play(8, 8, 'F');
+    game.play(8, 8, 'R');
+    assert(game.getFlagsCount() == 2 && game.getRevealedCount() == 0 && game.getHiddenCount() == 79);
+    assert(game.isPlaying());
+
+    std::cout << "\u2705 Counters test passed\n";
+}
+
+// Test to verify seeded generation is reproducible and exact at any density
+void testSeededGeneration()
+{
+    Board first(30, 20, 150, 42);
+    Board second(30, 20, 150, 42);
+    Board other(30, 20, 150, 43);
+
+    bool different = false;
+    for (std::size_t i = 0; i < first.getBoard().size(); ++i)
+    {
+        assert(first.getBoard()[i].isMine() == second.getBoard()[i].isMine());
+        different |= first.getBoard()[i].isMine() != other.getBoard()[i].isMine();
+    }
+    assert(different);
+    assert(first.getSeed() == 42);
+
+    // Nearly full board: exactly one safe cell must remain
+    Board dense(40, 40, 40 * 40 - 1, 7);
+    int safe = 0;
+    for (const Cell &cell : dense.getBoard())
+        safe += !cell.isMine();
+    assert(safe == 1);
+
+    std::cout << "\u2705 Seeded generation test passed\n";
+}
+
+// Test to verify spreadsheet-style columns and input parsing on boards wider than 26
+void testLargeCoordinates()
+{
+    assert(Coordinates::columnLabel(0) == "A");
+    assert(Coordinates::columnLabel(25) == "Z");
+    assert(Coordinates::columnLabel(26) == "AA");
+    assert(Coordinates::columnLabel(701) == "ZZ");
+    assert(Coordinates::columnLabel(702) == "AAA");
+    for (int column = 0; column < 20000; ++column)
+        assert(Coordinates::parseColumnLabel(Coordinates::columnLabel(column)) == column);
+
+    Game game(1000, 500, 10);
+    assert(game.isValidInput("AB300 F"));
+    assert(game.isValidInput("1000,500"));
+    assert(!game.isValidInput("1001,500"));
+    assert(!game.isValidInput("A501"));
+    assert(!game.isValidInput("A99999999999"));
+
+    auto [column, row, action] = game.parseInput("AB300 F");
+    assert(column == 27 && row == 299 && action == 'F');
+    auto [numericColumn, numericRow, numericAction] = game.parseInput("12,40");
+    assert(numericColumn == 11 && numericRow == 39 && numericAction == 'R');
+
+    std::cout << "\u2705 Large coordinates test passed\n";
+}
+
+// Test to verify lazily generated chunks: determinism, numbers across chunk edges and lazy memory
+void testChunkedBoard()
+{
+    ChunkedBoard world(600, 99);
+    ChunkedBoard sameWorld(600, 99);
+
+    // Access far away first in one world; generation order must not change the result
+    (void)sameWorld.getCell(1'000'000'000, -5'000'000'000);
+    assert(world.getChunkCount() == 0);
+
+    for (std::int64_t r = -70; r < 70; r += 3)
+    {
+        for (std::int64_t c = -70; c < 70; ++c)
+        {
+            const Cell cell = world.getCell(c, r);
+            assert(cell.isMine() == sameWorld.getCell(c, r).isMine());
+            if (cell.isMine())
+                continue;
+
+            int expected = 0;
+            for (int dr = -1; dr <= 1; ++dr)
+                for (int dc = -1; dc <= 1; ++dc)
+                    expected += (dr || dc) && world.isMine(c + dc, r + dr);
+            assert(cell.getNearbyMines() == expected);
+        }
+    }
+
+    ChunkedBoard lazy(600, 1);
+    (void)lazy.getCell(5, 5);
+    assert(lazy.getChunkCount() == 9); // one numbered chunk plus its eight mine-only neighbours
+
+    ChunkedBoard sparse(0, 3);
+    assert(sparse.reveal(0, 0, 10'000) >= 10'000 && sparse.hasPendingReveal());
+    assert(sparse.resumeReveal(100) >= 100);
+
+    // Chording a number whose mines are flagged opens the rest of its neighbours
+    ChunkedBoard chording(600, 99);
+    std::int64_t number = 0;
+    while (chording.isMine(number, 0) || chording.getCell(number, 0).getNearbyMines() == 0)
+        ++number;
+    assert(chording.reveal(number, 0) == 1 && chording.chord(number, 0) == 0);
+    for (std::int64_t r = -1; r <= 1; ++r)
+        for (std::int64_t c = number - 1; c <= number + 1; ++c)
+            if (chording.isMine(c, r))
+                chording.toggleFlag(c, r);
+    assert(chording.chord(number, 0) > 0 && !chording.isLost());
+    for (std::int64_t r = -1; r <= 1; ++r)
+        for (std::int64_t c = number - 1; c <= number + 1; ++c)
+            assert(!chording.getCell(c, r).isHidden());
+
+    // Revealing a mine loses the world, and nothing more is revealed
+    std::int64_t mine = 0;
+    while (!world.isMine(mine, 0))
+        ++mine;
+    assert(world.reveal(mine, 0) == 1 && world.isLost());
+    assert(world.reveal(mine + 1, 0) == 0 && world.chord(number, 0) == 0);
+
+    std::cout << "\u2705 Chunked board test passed\n";
+}
+
+// Test to verify the solver only proves true facts and can drive a game without losing
+void testSolver()
+{
+    Game game(30, 16, 99, 2024);
+    const Board &board = game.getBoard();
+
+    // Start on an empty cell (peeking is fine for the test harness, not for the solver)
+    std::size_t start = 0;
+    while (board.getBoard()[start].isMine() || board.getBoard()[start].getNearbyMines() != 0)
+        ++start;
+
+    Solver solver(board);
+    game.play(static_cast<int>(start % 30), static_cast<int>(start / 30), 'R');
+    solver.notifyRevealed(game.getChanges());
+
+    int column, row, moves = 0;
+    while (game.isPlaying() && (solver.solve(), solver.nextSafeCell(column, row)))
+    {
+        game.play(column, row, 'R');
+        solver.notifyRevealed(game.getChanges());
+        game.checkWinCondition();
+        ++moves;
+    }
+
+    assert(!game.isLost());
+    assert(moves > 0 && solver.getDeductionCount() > 0);
+    for (const std::uint32_t index : solver.getKnownMines())
+        assert(board.getBoard()[index].isMine());
+    for (std::size_t i = 0; i < board.getBoard().size(); ++i)
+        if (solver.isKnownSafe(static_cast<int>(i % 30), static_cast<int>(i / 30)))
+            assert(!board.getBoard()[i].isMine());
+
+    std::cout << "\u2705 Solver test passed\n";
+}
+
+// Test to verify exact probabilities against solver facts and caching of untouched components
+void testProbabilityEngine()
+{
+    Game game(16, 16, 40, 5);
+    const Board &board = game.getBoard();
+
+    std::size_t start = 0;
+    while (board.getBoard()[start].isMine() || board.getBoard()[start].getNearbyMines() != 0)
+        ++start;
+    game.play(static_cast<int>(start % 16), static_cast<int>(start / 16), 'R');
+
+    ProbabilityEngine engine(board);
+    engine.compute();
+    assert(engine.getComponentCount() > 0);
+
+    // Probabilities are consistent: they add up to the mine count and agree with proven facts
+    Solver solver(board);
+    solver.solve();
+    double total = 0;
+    for (int r = 0; r < 16; ++r)
+    {
+        for (int c = 0; c < 16; ++c)
+        {
+            const double p = engine.getProbability(c, r);
+            assert(p >= 0.0 && p <= 1.0 + 1e-9);
+            if (board.getCell(c, r).isRevealed())
+                assert(p == 0.0);
+            if (solver.isKnownMine(c, r))
+                assert(p > 1.0 - 1e-9);
+            if (solver.isKnownSafe(c, r))
+                assert(p < 1e-9);
+            total += p;
+        }
+    }
+    assert(std::abs(total - 40.0) < 1e-6);
+
+    int column, row;
+    assert(engine.bestGuess(column, row) && board.getCell(column, row).isHidden());
+    for (int r = 0; r < 16; ++r)
+        for (int c = 0; c < 16; ++c)
+            if (board.getCell(c, r).isHidden())
+                assert(engine.getProbability(column, row) <= engine.getProbability(c, r));
+
+    // Recomputing an unchanged board is served entirely from the cache
+    const std::size_t misses = engine.getCacheMisses();
+    engine.compute();
+    assert(engine.getCacheMisses() == misses);
+    assert(engine.getCacheHits() >= engine.getComponentCount());
+
+    std::cout << "\u2705 Probability engine test passed\n";
+}
+
+// Test to verify every probability against a brute-force count of the consistent layouts
+void testProbabilityEngineBruteForce()
+{
+    // 22 hidden cells: three frontier components and five interior cells. The frontier alone
+    // could hold 8 to 11 mines, so the global count of 10 rules some layouts out and reweights the rest
+    Game game(8, 6, 10, 14241);
+    for (const auto [c, r] : {std::pair{0, 3}, {4, 1}, {6, 0}, {0, 1}, {1, 2}})
+        game.play(c, r, 'R');
+    const Board &board = game.getBoard();
+    assert(game.isPlaying() && board.getHiddenCount() == 22);
+
+    ProbabilityEngine engine(board);
+    engine.compute();
+    assert(engine.getComponentCount() == 3);
+
+    // Each revealed number as the bit set of its hidden neighbours (bit i: i-th hidden cell)
+    std::vector<std::size_t> hidden;
+    for (std::size_t i = 0; i < board.getBoard().size(); ++i)
+        if (board.getBoard()[i].isHidden())
+            hidden.push_back(i);
+    std::vector<std::pair<std::uint32_t, int>> numbers;
+    for (int r = 0; r < 6; ++r)
+    {
+        for (int c = 0; c < 8; ++c)
+        {
+            if (!board.getCell(c, r).isRevealed())
+                continue;
+            std::uint32_t neighbours = 0;
+            for (std::size_t bit = 0; bit < hidden.size(); ++bit)
+            {
+                const int dc = static_cast<int>(hidden[bit] % 8) - c, dr = static_cast<int>(hidden[bit] / 8) - r;
+                if (std::abs(dc) <= 1 && std::abs(dr) <= 1)
+                    neighbours |= std::uint32_t{1} << bit;
+            }
+            numbers.emplace_back(neighbours, board.getCell(c, r).getNearbyMines());
+        }
+    }
+
+    // Every placement of the 10 mines on the hidden cells that matches all numbers is equally likely
+    std::vector<double> mineLayouts(hidden.size(), 0.0);
+    double layouts = 0;
+    for (std::uint32_t layout = 0; layout < (std::uint32_t{1} << hidden.size()); ++layout)
+    {
+        if (std::popcount(layout) != 10 || !std::ranges::all_of(numbers, [layout](const auto &number) {
+                return std::popcount(layout & number.first) == number.second;
+            }))
+            continue;
+        ++layouts;
+        for (std::size_t bit = 0; bit < hidden.size(); ++bit)
+            mineLayouts[bit] += (layout >> bit) & 1;
+    }
+    assert(layouts > 0);
+
+    for (std::size_t bit = 0; bit < hidden.size(); ++bit)
+    {
+        const double expected = mineLayouts[bit] / layouts;
+        const double p = engine.getProbability(static_cast<int>(hidden[bit] % 8), static_cast<int>(hidden[bit] / 8));
+        assert(std::abs(p - expected) < 1e-9);
+    }
+
+    std::cout << "\u2705 Probability engine brute force test passed\n";
+}
+
+// Test to verify that combining thousands of components stays small on a large board
+void testProbabilityEngineLargeBoard()
+{
+    // Opened from the centre and played by the solver until it needs a guess
+    Game game(500, 500, 31250, 1, 250, 250);
+    const Board &board = game.getBoard();
+    Solver solver(board);
+    int column = 250, row = 250;
+    do
+    {
+        game.play(column, row, 'R');
+        solver.notifyRevealed(game.getChanges());
+        solver.solve();
+    } while (solver.nextSafeCell(column, row));
+    assert(game.isPlaying());
+
+    ProbabilityEngine engine(board);
+    const std::size_t liveBefore = g_liveBytes;
+    g_peakBytes = liveBefore;
+    engine.compute();
+
+    assert(engine.getComponentCount() > 1000);
+    assert(g_peakBytes - liveBefore < 64u << 20);
+
+    double total = 0;
+    for (int r = 0; r < 500; ++r)
+        for (int c = 0; c < 500; ++c)
+            total += engine.getProbability(c, r);
+    assert(std::abs(total - 31250.0) < 1e-3);
+
+    std::cout << "\u2705 Probability engine large board test passed\n";
+}
+
+// Test to verify the first-click safe zone and that the no-guess search is deterministic
+void testNoGuessGenerator()
+{
+    Board board(9, 9, 80, 7, 0, 4);
+    assert(board.getMines() == 75); // clamped to the cells outside the 2x3 safe zone
+    int mines = 0;
+    for (int r = 0; r < 9; ++r)
+        for (int c = 0; c < 9; ++c)
+            mines += board.getCell(c, r).isMine();
+    assert(mines == 75);
+    assert(board.getCell(0, 4).isEmpty() && !board.getCell(1, 5).isMine());
+
+    // Expert density: the winner is the lowest solvable attempt, whatever the thread count
+    const NoGuessGenerator generator(30, 16, 99, 15, 8);
+    const NoGuessGenerator::Result single = generator.generate(11, 10000, 1);
+    const NoGuessGenerator::Result parallel = generator.generate(11, 10000, 4);
+    assert(single.found && parallel.found);
+    assert(single.attempt == parallel.attempt && single.seed == parallel.seed);
+    assert(generator.isSolvable(single.seed));
+    for (std::uint64_t attempt = 0; attempt < single.attempt; ++attempt)
+        assert(!generator.isSolvable(NoGuessGenerator::candidateSeed(11, attempt)));
+
+    std::cout << "\u2705 No-guess generator test passed (attempt " << single.attempt << ")\n";
+}
+
+// Test to verify in-place resets match fresh boards and that bots finish their games
+void testResetAndBots()
+{
+    Game game(30, 16, 99, 1, 15, 8);
+    game.play(15, 8, 'R');
+    game.play(0, 0, 'F');
+    game.reset(77, 15, 8);
+
+    const Board fresh(30, 16, 99, 77, 15, 8);
+    const Board &board = game.getBoard();
+    assert(game.isPlaying() && board.getFlagCount() == 0 && board.getHiddenCount() == 30 * 16);
+    for (std::size_t i = 0; i < fresh.getBoard().size(); ++i)
+        assert(board.getBoard()[i].getContent() == fresh.getBoard()[i].getContent() &&
+               board.getBoard()[i].getNearbyMines() == fresh.getBoard()[i].getNearbyMines() &&
+               board.getBoard()[i].isHidden());
+
+    for (const Bot::Strategy strategy : {Bot::Strategy::Random, Bot::Strategy::Solver, Bot::Strategy::Probability})
+    {
+        Bot bot(game, strategy);
+        for (std::uint64_t seed = 0; seed < 20; ++seed)
+        {
+            game.reset(seed, 15, 8);
+            bot.reset();
+            assert(bot.playToEnd(15, 8) > 0 && !game.isPlaying());
+        }
+    }
+
+    std::cout << "\u2705 Reset and bot test passed\n";
+}
+
+// Test to verify the frame layout of the buffered renderer
+void testRenderer()
+{
+    Game game(28, 9, 30, 3, 0, 0);
+    game.play(0, 0, 'R');
+    game.play(27, 8, 'F');
+
+    BoardRenderer renderer;
+    const std::string frame(renderer.render(game.getBoard()));
+    assert(std::ranges::count(frame, '\n') == 9 + 3);
+    assert(frame.find("AB") != std::string::npos);
+    assert(frame.find(" F ") != std::string::npos && frame.find(" # ") != std::string::npos);
+
+    // Rendering again reuses the buffer and gives the same frame
+    assert(renderer.render(game.getBoard()) == frame);
+
+    std::cout << "\u2705 Renderer test passed\n";
+}
+
+// Test to verify the move grammar (several moves, attached actions, chords) and size parsing
+void testMoveParser()
+{
+    std::string_view line = " A1 b2f C3 R 4,5C AB12 F";
+    InputData move{};
+    const InputData expected[] = {{0, 0, 'R'}, {1, 1, 'F'}, {2, 2, 'R'}, {3, 4, 'C'}, {27, 11, 'F'}};
+    for (const InputData &want : expected)
+    {
+        assert(MoveParser::next(line, move) == MoveParser::Result::Move);
+        assert(move.column == want.column && move.row == want.row && move.action == want.action);
+    }
+    assert(MoveParser::next(line, move) == MoveParser::Result::End);
+
+    for (std::string_view bad : {"A", "1,", "A1X", "A-1", "3,-4", "AAAAAAA1", "A99999999999"})
+        assert(MoveParser::next(bad, move) == MoveParser::Result::Invalid);
+
+    int columns = 0, rows = 0;
+    assert(MoveParser::parseSize(" 30x16 ", columns, rows) && columns == 30 && rows == 16);
+    assert(MoveParser::parseSize("8X10", columns, rows) && columns == 8 && rows == 10);
+    assert(!MoveParser::parseSize("8x", columns, rows) && !MoveParser::parseSize("8x10x2", columns, rows));
+    assert(!MoveParser::parseSize("99999999999x5", columns, rows));
+
+    // A chord reveals the neighbours of a number once its mines are flagged
+    Game game(9, 9, 10, 3);
+    const Board &board = game.getBoard();
+    int numberColumn = -1, numberRow = -1;
+    for (int r = 1; r < 8 && numberColumn < 0; ++r)
+        for (int c = 1; c < 8 && numberColumn < 0; ++c)
+            if (board.getCell(c, r).isNumber() && board.getCell(c, r).getNearbyMines() > 0)
+                numberColumn = c, numberRow = r;
+
+    game.play(numberColumn, numberRow, 'R');
+    for (int r = numberRow - 1; r <= numberRow + 1; ++r)
+        for (int c = numberColumn - 1; c <= numberColumn + 1; ++c)
+            if (board.getCell(c, r).isMine())
+                game.play(c, r, 'F');
+    assert(game.chord(numberColumn, numberRow) > 0 && game.isPlaying());
+    for (int r = numberRow - 1; r <= numberRow + 1; ++r)
+        for (int c = numberColumn - 1; c <= numberColumn + 1; ++c)
+            assert(board.getCell(c, r).isMine() ? board.getCell(c, r).isFlagged() : board.getCell(c, r).isRevealed());
+
+    assert(game.isValidInput("A1 B2F 3,4 C"));
+    assert(!game.isValidInput("A1 J1") && !game.isValidInput("A1 FF") && !game.isValidInput("   "));
+
+    std::cout << "\u2705 Move parser test passed\n";
+}
+
+// Test to verify batched moves: outcomes per move and stopping at the first loss
+void testPlayBatch()
+{
+    Game game(9, 9, 10, 8, 4, 4);
+    const Board &board = game.getBoard();
+
+    int mineColumn = 0, mineRow = 0;
+    while (!board.getCell(mineColumn, mineRow).isMine())
+        if (++mineColumn == 9)
+            mineColumn = 0, ++mineRow;
+
+    const InputData moves[] = {{4, 4, 'R'}, {4, 4, 'R'}, {mineColumn, mineRow, 'F'}, {mineColumn, mineRow, 'F'},
+                               {9, 0, 'R'}, {0, 0, 'X'}, {mineColumn, mineRow, 'R'}, {4, 4, 'F'}};
+    MoveOutcome outcomes[8];
+    assert(game.playBatch(moves, outcomes) == 7);
+
+    const MoveOutcome expected[] = {MoveOutcome::Revealed, MoveOutcome::None,    MoveOutcome::Flagged,
+                                    MoveOutcome::Unflagged, MoveOutcome::Invalid, MoveOutcome::Invalid,
+                                    MoveOutcome::Exploded, MoveOutcome::Skipped};
+    for (int i = 0; i < 8; ++i)
+        assert(outcomes[i] == expected[i]);
+    assert(game.isLost());
+
+    std::cout << "\u2705 Batch play test passed\n";
+}
+
+void testGameStatus()
+{
+    Game game(30, 16, 99, 21);
+    GameStatus status = game.getStatus();
+    assert(status.columns == 30 && status.rows == 16 && status.mines == 99);
+    assert(status.moves == 0 && status.elapsedMs == 0 && status.state == 0);
+
+    // Clicking every opening once, then every number left, clears the board in exactly 3BV clicks
+    const Board &board = game.getBoard();
+    int clicks = 0;
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (int r = 0; r < 16; ++r)
+        {
+            for (int c = 0; c < 30; ++c)
+            {
+                const Cell cell = board.getCell(c, r);
+                if (cell.isHidden() && (pass == 0 ? cell.isEmpty() : cell.isNumber()))
+                {
+                    game.play(c, r, 'R');
+                    ++clicks;
+                }
+            }
+        }
+    }
+    game.checkWinCondition();
+    assert(game.isWon());
+
+    status = game.getStatus();
+    assert(status.threeBV == clicks && status.moves == clicks);
+    assert(status.lastRevealed == 1 && status.revealed == 30 * 16 - 99 && status.state == 1);
+    assert(status.elapsedMs >= 0);
+
+    game.reset(22);
+    assert(game.getStatus().moves == 0 && Board(30, 16, 99, 22).getThreeBV() == game.getStatus().threeBV);
+
+    std::cout << "\u2705 Game status test passed\n";
+}
+
+void testCellChanges()
+{
+    Game game(16, 16, 40, 31, 8, 8);
+    const Board &board = game.getBoard();
+    using Reason = ChangeReason;
+
+    game.play(0, 0, 'F');
+    assert(game.getChanges().size() == 1 && game.getChanges()[0].reason == Reason::Flagged);
+    game.play(0, 0, 'F');
+    assert(game.getChanges().size() == 1 && game.getChanges()[0].reason == Reason::Unflagged);
+
+    // The opening reports each revealed cell exactly once
+    game.play(8, 8, 'R');
+    const int revealed = board.getRevealedSafeCount();
+    assert(revealed > 1 && static_cast<int>(game.getChanges().size()) == revealed);
+    for (const auto [index, reason] : game.getChanges())
+        assert(reason == Reason::Revealed && board.getBoard()[index].isRevealed());
+
+    game.play(8, 8, 'R');
+    assert(game.getChanges().empty());
+
+    // A line collects all its moves; a mine ends it with an explosion
+    std::size_t mine = 0;
+    while (!board.getBoard()[mine].isMine())
+        ++mine;
+    const std::string line = std::to_string(mine % 16 + 1) + "," + std::to_string(mine / 16 + 1);
+    assert(game.playLine(line + "F " + line + "F " + line));
+    const std::vector<CellChange> &changes = game.getChanges();
+    assert(changes.size() == 3 && changes[0].reason == Reason::Flagged && changes[1].reason == Reason::Unflagged);
+    assert(changes[2].index == mine && changes[2].reason == Reason::Exploded && game.isLost());
+
+    std::cout << "\u2705 Cell change test passed\n";
+}
+
+void testUndoRedo()
+{
+    Game game(64, 64, 600, 41, 32, 32);
+    game.enableHistory();
+    const Board &board = game.getBoard();
+    std::vector<std::uint8_t> initial, opened, final;
+    board.packVisibleState(initial);
+
+    // Play safe cells (and a few flags) until the game is won
+    game.play(32, 32, 'R');
+    board.packVisibleState(opened);
+    for (std::size_t i = 0; i < board.getBoard().size() && game.isPlaying(); ++i)
+    {
+        const Cell cell = board.getBoard()[i];
+        const int column = static_cast<int>(i % 64), row = static_cast<int>(i / 64);
+        if (cell.isMine() && i % 7 == 0)
+            game.play(column, row, 'F');
+        else if (!cell.isMine() && cell.isHidden())
+            game.play(column, row, 'R');
+        game.checkWinCondition();
+    }
+    assert(game.isWon());
+    board.packVisibleState(final);
+    const std::size_t played = game.getHistory().size();
+    assert(played > 10 && game.getHistory().getSnapshotCount() > 0);
+
+    // One undo hides exactly what the last move revealed
+    const CellChange last = game.getChanges().back();
+    assert(game.undo() && game.isPlaying());
+    assert(game.getChanges().size() == 1 && game.getChanges()[0].index == last.index);
+    assert(game.getChanges()[0].reason == ChangeReason::Hidden && board.getBoard()[last.index].isHidden());
+    assert(game.redo() && game.isWon());
+
+    // Rewinding (through a snapshot or step by step) restores every earlier position exactly
+    std::vector<std::uint8_t> state;
+    game.rewindTo(1);
+    board.packVisibleState(state);
+    assert(state == opened && game.getFlagsCount() == 0 && game.isPlaying());
+    game.rewindTo(played);
+    board.packVisibleState(state);
+    assert(state == final && game.isWon());
+    while (game.undo())
+        ;
+    board.packVisibleState(state);
+    assert(state == initial && board.getHiddenCount() == 64 * 64 && !game.undo());
+
+    // An explosion can be taken back; a new move then drops the redo branch
+    std::size_t mine = 0;
+    while (!board.getBoard()[mine].isMine())
+        ++mine;
+    game.redo();
+    game.play(static_cast<int>(mine % 64), static_cast<int>(mine / 64), 'R');
+    assert(game.isLost() && game.getHistory().size() == 2);
+    assert(game.undo() && game.isPlaying() && !board.getBoard()[mine].isRevealed());
+
+    std::cout << "\u2705 Undo/redo test passed\n";
+}
+
+// Plays every record of a replay on a fresh game built from its header
+Game playReplay(ReplayReader &reader)
+{
+    Game game = reader.createGame();
+    ReplayFormat::Record record{};
+    while (reader.next(record))
+    {
+        if (record.move.action == 'U')
+            game.undo();
+        else if (record.move.action == 'Y')
+            game.redo();
+        else
+            game.playBatch(std::span(&record.move, 1), {});
+    }
+    return game;
+}
+
+std::vector<std::uint8_t> bytesOf(const std::stringstream &stream)
+{
+    const std::string text = stream.str();
+    return {text.begin(), text.end()};
+}
+
+void testReplay()
+{
+    // Seeded safe-start board with undo: moves, flags, an explosion taken back, then a win
+    std::stringstream stream;
+    Game game(40, 30, 200, 77, 20, 15);
+    game.enableHistory();
+    std::vector<std::uint8_t> expected, replayed;
+    {
+        ReplayWriter writer(stream, game);
+        game.setRecorder(&writer);
+        game.play(20, 15, 'R');
+
+        const Board &board = game.getBoard();
+        std::size_t mine = 0;
+        while (!board.getBoard()[mine].isMine())
+            ++mine;
+        game.play(static_cast<int>(mine % 40), static_cast<int>(mine / 40), 'R');
+        assert(game.isLost() && game.undo() && game.redo() && game.undo());
+        game.play(static_cast<int>(mine % 40), static_cast<int>(mine / 40), 'F');
+
+        for (std::size_t i = 0; i < board.getBoard().size() && game.isPlaying(); ++i)
+        {
+            if (!board.getBoard()[i].isMine() && board.getBoard()[i].isHidden())
+                game.play(static_cast<int>(i % 40), static_cast<int>(i / 40), 'R');
+            game.checkWinCondition();
+        }
+        assert(game.isWon());
+        game.rewindTo(game.getHistory().size() - 3);
+        game.rewindTo(game.getHistory().size());
+        game.setRecorder(nullptr);
+    }
+    game.getBoard().packVisibleState(expected);
+
+    ReplayReader reader(bytesOf(stream));
+    assert(reader.getHeader().columns == 40 && reader.getHeader().rows == 30 && reader.getHeader().seed == 77);
+    assert(reader.getHeader().safeColumn == 20 && reader.getHeader().history && reader.getHeader().layout.empty());
+    Game copy = playReplay(reader);
+    copy.getBoard().packVisibleState(replayed);
+    assert(copy.isWon() && replayed == expected && copy.getFlagsCount() == game.getFlagsCount());
+
+    // Rewinding the reader plays the same records again on a board restarted in place
+    reader.rewind();
+    reader.restart(copy);
+    assert(copy.getRevealedCount() == 0);
+
+    // A stored layout rebuilds the board without the generator
+    std::stringstream layoutStream;
+    Game plain(33, 9, 40, 5);
+    {
+        ReplayWriter writer(layoutStream, plain, true);
+        plain.setRecorder(&writer);
+        plain.play(0, 0, 'F');
+        plain.play(32, 8, 'R');
+        plain.play(16, 4, 'R');
+        plain.setRecorder(nullptr);
+    }
+    plain.getBoard().packVisibleState(expected);
+    ReplayReader layoutReader(bytesOf(layoutStream));
+    assert(layoutReader.getHeader().layout.size() == (33 * 9 + 7) / 8 && layoutReader.getHeader().safeColumn < 0);
+    Game rebuilt = playReplay(layoutReader);
+    rebuilt.getBoard().packVisibleState(replayed);
+    assert(replayed == expected && rebuilt.getMinesTotal() == 40 && rebuilt.getStateValue() == plain.getStateValue());
+    for (int r = 0; r < 9; ++r)
+        for (int c = 0; c < 33; ++c)
+            assert(rebuilt.getBoard().getMineLayer().test(c, r) == plain.getBoard().getMineLayer().test(c, r));
+
+    // Malformed data is reported, not played
+    std::vector<std::uint8_t> truncated = bytesOf(layoutStream);
+    truncated.resize(truncated.size() - 1);
+    ReplayReader cut(truncated);
+    ReplayFormat::Record record{};
+    bool threw = false;
+    try
+    {
+        while (cut.next(record))
+            ;
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try
+    {
+        ReplayReader({'N', 'O', 'P', 'E', 1, 0});
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "\u2705 Replay test passed\n";
+}
+
+void testSaveResume()
+{
+    Game game(70, 45, 500, 123, 35, 22);
+    game.enableHistory();
+    game.play(35, 22, 'R');
+    const Board &board = game.getBoard();
+    std::size_t mine = 0;
+    while (!board.getBoard()[mine].isMine())
+        ++mine;
+    game.play(static_cast<int>(mine % 70), static_cast<int>(mine / 70), 'F');
+
+    // Through a real file: one write out, a mapping back in
+    const std::vector<std::uint8_t> bytes = game.save();
+    assert(bytes.size() == SaveFormat::fileSize({.columns = 70, .rows = 45, .wordsPerRow = 2}));
+    const std::string path = "test_save.mssv";
+    std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char *>(bytes.data()),
+                                                static_cast<std::streamsize>(bytes.size()));
+    {
+        const MappedFile file(path);
+        assert(file.bytes().size() == bytes.size());
+        Game resumed = Game::load(file.bytes());
+
+        const Board &copy = resumed.getBoard();
+        assert(std::memcmp(copy.getBoard().data(), board.getBoard().data(), board.getBoard().size()) == 0);
+        assert(copy.getMineLayer().getBytes().size() == board.getMineLayer().getBytes().size());
+        assert(std::memcmp(copy.getMineLayer().getBytes().data(), board.getMineLayer().getBytes().data(),
+                           board.getMineLayer().getBytes().size()) == 0);
+        assert(resumed.getSeed() == 123 && copy.getSafeColumn() == 35 && copy.getSafeRow() == 22);
+        assert(resumed.getFlagsCount() == 1 && resumed.getRevealedCount() == game.getRevealedCount());
+        assert(resumed.getHiddenCount() == game.getHiddenCount() && resumed.getMoveCount() == 2);
+        assert(resumed.isPlaying() && resumed.isHistoryEnabled() && resumed.getHistory().size() == 0);
+        assert(copy.getThreeBV() == board.getThreeBV());
+
+        // Both games continue identically to the end
+        for (std::size_t i = 0; i < board.getBoard().size() && game.isPlaying(); ++i)
+        {
+            if (board.getBoard()[i].isMine() || !board.getBoard()[i].isHidden())
+                continue;
+            game.play(static_cast<int>(i % 70), static_cast<int>(i / 70), 'R');
+            resumed.play(static_cast<int>(i % 70), static_cast<int>(i / 70), 'R');
+            game.checkWinCondition();
+            resumed.checkWinCondition();
+        }
+        assert(game.isWon() && resumed.isWon() && resumed.getMoveCount() == game.getMoveCount());
+        assert(std::memcmp(copy.getBoard().data(), board.getBoard().data(), board.getBoard().size()) == 0);
+    }
+    std::remove(path.c_str());
+
+    // A finished game keeps its state
+    const Game won = Game::load(game.save());
+    assert(won.isWon() && won.getElapsedMilliseconds() == game.getElapsedMilliseconds());
+
+    // Anything that is not a complete, consistent save is rejected
+    const auto rejects = [](std::vector<std::uint8_t> data) {
+        try
+        {
+            Game::load(data);
+        }
+        catch (const std::runtime_error &)
+        {
+            return true;
+        }
+        return false;
+    };
+    std::vector<std::uint8_t> damaged = bytes;
+    damaged.pop_back();
+    assert(rejects(damaged));
+    damaged = bytes;
+    damaged[0] = 'X';
+    assert(rejects(damaged));
+    damaged = bytes;
+    damaged[offsetof(SaveFormat::Header, hidden) + 3] = 0x80; // negative counter
+    assert(rejects(damaged));
+    assert(rejects({}));
+
+    // Cells and mine words are checked against each other and the header counters
+    const std::size_t cellsAt = sizeof(SaveFormat::Header);
+    const std::size_t wordsAt = SaveFormat::layerOffset({.columns = 70, .rows = 45, .wordsPerRow = 2});
+    std::size_t number = 0, hidden = 0;
+    while (std::bit_cast<Cell>(bytes[cellsAt + number]).getContent() != CellContent::Number)
+        ++number;
+    while (!std::bit_cast<Cell>(bytes[cellsAt + hidden]).isHidden())
+        ++hidden;
+    const auto corrupt = [&](std::size_t at, std::uint8_t value) {
+        std::vector<std::uint8_t> data = bytes;
+        data[at] = value;
+        return rejects(std::move(data));
+    };
+    assert(corrupt(cellsAt + number, (bytes[cellsAt + number] & 0xF0) | 9));     // count above 8
+    assert(corrupt(cellsAt + number, bytes[cellsAt + number] & 0xF0));           // number without a count
+    assert(corrupt(cellsAt + hidden, bytes[cellsAt + hidden] | 0xC0));           // content 3
+    assert(corrupt(cellsAt + hidden, bytes[cellsAt + hidden] | 0x30));           // state 3
+    assert(corrupt(cellsAt + hidden, bytes[cellsAt + hidden] | 0x20));           // flag not in the counters
+    assert(corrupt(cellsAt + mine, bytes[cellsAt + mine] & 0x3F));               // mine missing from the cells
+    assert(corrupt(wordsAt, bytes[wordsAt] ^ 0x01));                             // bit-plane disagrees
+    assert(corrupt(wordsAt + 15, bytes[wordsAt + 15] | 0x80));                   // bit past the last column
+    assert(!rejects(bytes));
+
+    std::cout << "\u2705 Save/resume test passed\n";
+}
+
+void testSessionManager()
+{
+    SessionManager manager;
+    std::vector<std::uint32_t> owned;
+    std::string out;
+
+    manager.handle("CREATE 10 8 10 3", out, owned);
+    assert(out == "OK 1 3\n" && owned.size() == 1 && manager.size() == 1);
+
+    // Same seed, same board: the protocol plays exactly like a local Game
+    Game local(10, 8, 10, 3);
+    local.playLine("E4 A1F");
+    out.clear();
+    manager.handle("play 1 e4 a1f", out, owned);
+    assert(out == "OK 0 " + std::to_string(local.getChanges().size()) + "\n");
+
+    out.clear();
+    manager.handle("BATCH 1 0 0 F 99 2 R", out, owned);
+    assert(out == "OK 2 0\n");
+    local.play(0, 0, 'F');
+
+    out.clear();
+    manager.handle("VIEW 1", out, owned);
+    assert(out.size() == std::string("OK 10 8 \n").size() + 80);
+    const std::string_view cells = std::string_view(out).substr(8, 80);
+    for (std::size_t i = 0; i < cells.size(); ++i)
+    {
+        const Cell cell = local.getBoard().getBoard()[i];
+        assert(cells[i] == (cell.isFlagged() ? 'F' : !cell.isRevealed() ? '#' : char('0' + cell.getNearbyMines())));
+    }
+
+    out.clear();
+    manager.handle("STATUS 1", out, owned);
+    assert(out.starts_with("OK 10 8 10 0 " + std::to_string(local.getRevealedCount()) + " 0 3 "));
+
+    // Every request gets exactly one response line
+    for (const char *bad : {"", "FOO", "PLAY", "PLAY 9 A1", "PLAY 1 Z99", "BATCH 1 0 0", "CREATE 2 2", "CREATE 10 x"})
+    {
+        out.clear();
+        manager.handle(bad, out, owned);
+        assert(out.starts_with("ERR ") && out.back() == '\n' && std::ranges::count(out, '\n') == 1);
+    }
+
+    out.clear();
+    manager.handle("CLOSE 1", out, owned);
+    manager.handle("CLOSE 1", out, owned);
+    assert(out == "OK\nERR no such session\n" && manager.size() == 0);
+    assert(manager.getPoolStats().idleGames == 1);
+
+    // A connection churning CREATE/CLOSE keeps only its open ids
+    assert(owned.empty());
+    for (int game = 0; game < 100; ++game)
+    {
+        out.clear();
+        manager.handle("CREATE 10 8 10 3", out, owned);
+        manager.handle("CLOSE " + std::to_string(owned.back()), out, owned);
+        assert(out.ends_with("\nOK\n") && owned.empty());
+    }
+
+    // Sessions on different threads run in parallel without interfering
+    std::vector<std::thread> threads;
+    std::vector<std::vector<std::uint32_t>> created(8);
+    for (int t = 0; t < 8; ++t)
+    {
+        threads.emplace_back([&manager, &created, t] {
+            std::string response;
+            for (int game = 0; game < 20; ++game)
+            {
+                response.clear();
+                manager.handle("CREATE 16 16 40 " + std::to_string(t * 100 + game), response, created[t]);
+                const std::string id = std::to_string(created[t].back());
+                for (int r = 0; r < 16; ++r)
+                    manager.handle("BATCH " + id + " 0 " + std::to_string(r) + " R", response, created[t]);
+                manager.handle("STATUS " + id, response, created[t]);
+                assert(std::ranges::count(response, '\n') == 18 && response.find("ERR") == std::string::npos);
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+        thread.join();
+    assert(manager.size() == 160);
+    for (const std::vector<std::uint32_t> &ids : created)
+        manager.close(ids);
+    assert(manager.size() == 0);
+
+    // The open games share a cell budget; closing one frees its share
+    SessionManager budget({}, 1'000'000, 1000);
+    std::vector<std::uint32_t> budgetIds;
+    out.clear();
+    budget.handle("CREATE 20 20", out, budgetIds);
+    budget.handle("CREATE 20 20", out, budgetIds);
+    budget.handle("CREATE 20 20", out, budgetIds);
+    assert(out.ends_with("\nERR too many cells\n") && budget.size() == 2);
+    out.clear();
+    budget.handle("CLOSE " + std::to_string(budgetIds.front()), out, budgetIds);
+    budget.handle("CREATE 20 20", out, budgetIds);
+    assert(out.starts_with("OK\nOK ") && budget.size() == 2);
+    budget.close(budgetIds);
+    out.clear();
+    budget.handle("CREATE 31 32", out, budgetIds);
+    assert(out.starts_with("OK ") && budget.size() == 1);
+
+    // A raised side limit still refuses boards whose cell count does not fit in an int
+    BoardLimits wide{5, 100000};
+    assert(wide.accepts(100000, 20) && wide.accepts(46340, 46340));
+    assert(!wide.accepts(50000, 50000) && !wide.accepts(100000, 100000));
+    int columns = 100000, rows = 100000;
+    wide.clamp(columns, rows);
+    assert(columns == 100000 && rows == 21474 && wide.accepts(columns, rows));
+    BoardLimits huge{5, std::numeric_limits<int>::max()};
+    columns = rows = std::numeric_limits<int>::max();
+    huge.clamp(columns, rows);
+    assert(rows == 5 && huge.accepts(columns, rows));
+
+    SessionManager raised(wide);
+    out.clear();
+    raised.handle("CREATE 50000 50000", out, owned);
+    assert(out.starts_with("ERR size") && raised.size() == 0);
+
+    std::cout << "\u2705 Session manager test passed\n";
+}
+
+void testGamePool()
+{
+    GamePool pool;
+    Game *first = nullptr;
+    {
+        GamePool::Lease game = pool.acquire(30, 16, 99, 1);
+        first = game.get();
+        game->enableHistory(true);
+        game->play(0, 0, 'F');
+    }
+    GamePool::Stats stats = pool.getStats();
+    assert(stats.created == 1 && stats.released == 1 && stats.idleGames == 1 && stats.idleCells == 480);
+
+    // Same shape: the idle game comes back regenerated, indistinguishable from a new one
+    {
+        GamePool::Lease game = pool.acquire(30, 16, 99, 7);
+        const Game fresh(30, 16, 99, 7);
+        assert(game.get() == first && !game->isHistoryEnabled() && game->getFlagsCount() == 0);
+        for (std::size_t i = 0; i < fresh.getBoard().getBoard().size(); ++i)
+            assert(game->getBoard().getBoard()[i].isMine() == fresh.getBoard().getBoard()[i].isMine());
+
+        // Another shape cannot use it
+        GamePool::Lease other = pool.acquire(30, 16, 98, 7);
+        assert(other.get() != first);
+    }
+    stats = pool.getStats();
+    assert(stats.created == 2 && stats.reused == 1 && stats.idleGames == 2);
+
+    // Steady churn of one shape stays off the heap once the buffers reached their size
+    // (the first pass grows them to the largest cascade of these seeds, the second replays them)
+    std::size_t before = 0;
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        before = g_allocations;
+        for (std::uint64_t seed = 100; seed < 300; ++seed)
+        {
+            GamePool::Lease game = pool.acquire(30, 16, 99, seed);
+            game->play(5, 5, 'R');
+        }
+    }
+    assert(g_allocations == before);
+
+    // Safe-start games are bucketed by the mines they place (clamped to the cells minus the
+    // zone), so an overfull request finds them again and a plain one does not inherit the clamp
+    GamePool crowded;
+    {
+        GamePool::Lease game = crowded.acquire(5, 5, 25, 1, 2, 2);
+        assert(game->getMinesTotal() == 16);
+    }
+    {
+        GamePool::Lease game = crowded.acquire(5, 5, 25, 2, 2, 2);
+        assert(game->getMinesTotal() == 16);
+        GamePool::Lease full = crowded.acquire(5, 5, 25, 3);
+        assert(full->getMinesTotal() == 25);
+    }
+    {
+        GamePool::Lease corner = crowded.acquire(5, 5, 30, 4, 0, 0);
+        assert(corner->getMinesTotal() == 21);
+    }
+    stats = crowded.getStats();
+    assert(stats.created == 3 && stats.reused == 1);
+
+    // Over the idle cap returned games are freed; adopted games join the pool
+    GamePool small(100);
+    {
+        GamePool::Lease a = small.acquire(10, 8, 10, 1);
+        GamePool::Lease b = small.acquire(10, 8, 10, 2);
+        GamePool::Lease c = small.adopt(Game(5, 5, 3, 3));
+        a.reset();
+        b.reset();
+        c.reset();
+    }
+    stats = small.getStats();
+    assert(stats.created == 3 && stats.released == 1 && stats.discarded == 2 && stats.idleCells == 80);
+    small.trim();
+    assert(small.getStats().idleGames == 0 && small.getStats().idleCells == 0);
+
+    std::cout << "\u2705 Game pool test passed\n";
+}
+
 int main()
 {
     std::cout << "🧪 Ejecutando tests unitarios...\n\n";
@@ -111,6 +1263,30 @@ int main()
         testCellStates();
         testCellContent();
         testMineCount();
+        testPackedCell();
+        testBoardNumbers(13, 7, 20);
+        testBoardNumbers(131, 17, 600); // several bit words and SIMD blocks per row
+        testFloodFill();
+        testCounters();
+        testSeededGeneration();
+        testLargeCoordinates();
+        testChunkedBoard();
+        testSolver();
+        testProbabilityEngine();
+        testProbabilityEngineBruteForce();
+        testProbabilityEngineLargeBoard();
+        testNoGuessGenerator();
+        testResetAndBots();
+        testRenderer();
+        testMoveParser();
+        testPlayBatch();
+        testGameStatus();
+        testCellChanges();
+        testUndoRedo();
+        testReplay();
+        testSaveResume();
+        testSessionManager();
+        testGamePool();
 
         std::cout << "\n✅ ¡Todos los tests pasaron exitosamente!\n";
         std::cout << "🎉 El proyecto está listo para producción.\n";
@@ -0,0 +1,34 @@
+#!/usr/bin/env bash
+# Runs the server over stdin / stdout: end of input and a reader that goes away early.
+# Usage: test_server_stdio.sh SERVER
+set -u
+server="$1"
+work="$(mktemp -d)"
+trap 'rm -rf "$work"' EXIT
+
+fail() {
+    echo "FAIL: $1"
+    exit 1
+}
+
+# A last request without '\n' is still answered, then the server exits on end of input
+printf 'CREATE 10 8 10 3\nSTATUS 1' > "$work/requests"
+"$server" < "$work/requests" > "$work/responses" || fail "exit status $? on end of input"
+[ "$(head -n 1 "$work/responses")" = "OK 1 3" ] || fail "unexpected CREATE response"
+[ "$(wc -l < "$work/responses")" -eq 2 ] || fail "expected two response lines"
+
+# Cheap long requests keep the file reader and the workers in step while stdout is closed (EPIPE),
+# which used to read the destroyed stdin connection
+head -c 65000 /dev/zero | tr '\0' 'X' > "$work/line"
+echo >> "$work/line"
+for i in $(seq 1 300); do cat "$work/line"; done > "$work/long"
+for run in 1 2 3; do
+    "$server" < "$work/long" | head -c 1 > /dev/null
+    status="${PIPESTATUS[0]}"
+    [ "$status" -eq 0 ] || fail "exit status $status with a closed stdout"
+done
+
+# A flag without its value is refused instead of falling back to serving stdin
+"$server" --socket < /dev/null > "$work/responses" 2>&1 && fail "--socket without a path was accepted"
+
+echo "Server stdio test passed"
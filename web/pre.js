@@ -5,8 +5,8 @@
  * @date 2025
  *
  * This module provides the JavaScript bridge between the web UI and the
- * Emscripten-compiled C++ minesweeper game! It handles user input, board
- * rendering with color styling, and status synchronization.
+ * Emscripten-compiled C++ minesweeper game! It handles user input, draws the
+ * board on a canvas straight from the WASM heap, and synchronizes the status.
  */
 
 var Module = Module || {};
@@ -27,8 +27,10 @@ Module.onAbort = function (msg) {
   // * DOM Element References
   // ===================================================================
   var inputEl, outputEl, formEl;
-  var colsEl, rowsEl, startBtn; // removed resetBtn
-  var stSize, stMines, stFlags, stRevealed, stState;
+  var canvasEl, canvasCtx, boardWrapEl;
+  var colsEl, rowsEl, seedEl, noGuessEl, startBtn; // removed resetBtn
+  var saveBtn, loadBtn, loadFileEl;
+  var stSize, stMines, stFlags, stRevealed, stMoves, stTime, stThreeBV, stState;
 
   // ===================================================================
   // * State Management
@@ -36,6 +38,7 @@ Module.onAbort = function (msg) {
   var runtimeReady = false; ///< WebAssembly runtime initialization status
   var gameInitialized = false; ///< Game instance creation status
   var lastGameState = -1; ///< Track last known game state to detect transitions
+  var clockTimer = null; ///< Interval refreshing the status clock while playing
 
   // iOS-like shake animation injection & trigger
   function triggerShake() {
@@ -74,17 +77,32 @@ Module.onAbort = function (msg) {
     if (!formEl) formEl = document.getElementById("input-form");
     if (!colsEl) colsEl = document.getElementById("cols");
     if (!rowsEl) rowsEl = document.getElementById("rows");
+    if (!seedEl) seedEl = document.getElementById("seed");
+    if (!noGuessEl) noGuessEl = document.getElementById("no-guess");
     if (!startBtn) startBtn = document.getElementById("start");
+    if (!saveBtn) saveBtn = document.getElementById("save");
+    if (!loadBtn) loadBtn = document.getElementById("load");
+    if (!loadFileEl) loadFileEl = document.getElementById("load-file");
+    if (!boardWrapEl) boardWrapEl = document.getElementById("board-wrap");
+    if (!canvasEl) {
+      canvasEl = document.getElementById("board");
+      if (canvasEl) canvasCtx = canvasEl.getContext("2d");
+    }
     // removed: resetBtn reference
     if (!stSize) stSize = document.getElementById("st-size");
     if (!stMines) stMines = document.getElementById("st-mines");
     if (!stFlags) stFlags = document.getElementById("st-flags");
     if (!stRevealed) stRevealed = document.getElementById("st-revealed");
+    if (!stMoves) stMoves = document.getElementById("st-moves");
+    if (!stTime) stTime = document.getElementById("st-time");
+    if (!stThreeBV) stThreeBV = document.getElementById("st-3bv");
     if (!stState) stState = document.getElementById("st-state");
 
     setupOutputCleaning();
     setupFormHandler();
     setupButtonHandlers();
+    setupCanvasHandlers();
+    setupHistoryKeys();
     setupInitialFocus();
   }
 
@@ -119,6 +137,39 @@ Module.onAbort = function (msg) {
       startBtn.addEventListener("click", handleGameStart);
       startBtn._hasEvent = true;
     }
+    if (saveBtn && !saveBtn._hasEvent) {
+      saveBtn.addEventListener("click", handleSave);
+      saveBtn._hasEvent = true;
+    }
+    if (loadBtn && loadFileEl && !loadBtn._hasEvent) {
+      loadBtn.addEventListener("click", function () {
+        loadFileEl.click();
+      });
+      loadFileEl.addEventListener("change", handleLoadFile);
+      loadBtn._hasEvent = true;
+    }
+  }
+
+  /**
+   * @brief Lets the player click cells instead of typing coordinates
+   */
+  function setupCanvasHandlers() {
+    if (canvasEl && !canvasEl._hasEvent) {
+      canvasEl.addEventListener("mousedown", handleCanvasClick);
+      canvasEl.addEventListener("contextmenu", function (e) {
+        e.preventDefault();
+      });
+      canvasEl._hasEvent = true;
+    }
+  }
+
+  /**
+   * @brief Binds Ctrl+Z / Ctrl+Y (Cmd on macOS, Ctrl+Shift+Z too) to undo and redo
+   */
+  function setupHistoryKeys() {
+    if (document._hasHistoryKeys) return;
+    document.addEventListener("keydown", handleHistoryKey);
+    document._hasHistoryKeys = true;
   }
 
   /**
@@ -158,12 +209,131 @@ Module.onAbort = function (msg) {
 
     try {
       Module.ccall("js_submit", "void", ["string"], [move]);
+      collectChanges();
       updateStatus();
     } catch (err) {
       console.error("Error calling js_submit:", err);
     }
   }
 
+  /**
+   * @brief Plays the clicked cell through js_play / js_chord (no text involved)
+   * @param {MouseEvent} e The mousedown event on the board canvas
+   *
+   * Left click reveals (or chords a revealed number), right click or
+   * Shift + click toggles a flag, middle click chords.
+   */
+  function handleCanvasClick(e) {
+    if (!runtimeReady || !gameInitialized || !drawn) return;
+    e.preventDefault();
+
+    // Client pixels -> canvas pixels -> cell
+    var rect = canvasEl.getBoundingClientRect();
+    var x = ((e.clientX - rect.left) * canvasEl.width) / rect.width;
+    var y = ((e.clientY - rect.top) * canvasEl.height) / rect.height;
+    var column = Math.floor((x - drawn.left) / drawn.cell);
+    var row = Math.floor((y - drawn.top) / drawn.cell);
+    if (column < 0 || row < 0 || column >= drawn.columns || row >= drawn.rows) return;
+
+    try {
+      if (e.button === 1) {
+        Module.ccall("js_chord", "number", ["number", "number"], [column, row]);
+      } else {
+        var action = "R";
+        if (e.button === 2 || e.shiftKey) {
+          action = "F";
+        } else {
+          var cell = Module.HEAPU8[drawn.ptr + row * drawn.columns + column];
+          if (((cell >> STATE_SHIFT) & 3) === STATE_REVEALED && cell & COUNT_MASK) action = "C";
+        }
+        Module.ccall("js_play", "number", ["number", "number", "number"], [column, row, action.charCodeAt(0)]);
+      }
+      collectChanges();
+      updateStatus();
+    } catch (err) {
+      console.error("Error calling js_play:", err);
+    }
+  }
+
+  /**
+   * @brief Undoes or redoes a move from the keyboard
+   * @param {KeyboardEvent} e The keydown event
+   *
+   * Typing in the move field keeps its own text undo until it is empty.
+   */
+  function handleHistoryKey(e) {
+    if (!runtimeReady || !gameInitialized || !(e.ctrlKey || e.metaKey)) return;
+    if (e.target === inputEl && inputEl.value) return;
+
+    var key = e.key.toLowerCase();
+    var redo = key === "y" || (key === "z" && e.shiftKey);
+    if (key !== "z" && !redo) return;
+    e.preventDefault();
+
+    try {
+      if (Module.ccall(redo ? "js_redo" : "js_undo", "number", [], [])) {
+        collectChanges();
+        updateStatus();
+      }
+    } catch (err) {
+      console.error("Error calling js_undo / js_redo:", err);
+    }
+  }
+
+  /**
+   * @brief Downloads the current game in the save format (see SaveFormat.h)
+   */
+  function handleSave() {
+    if (!runtimeReady || !gameInitialized) return;
+
+    try {
+      var size = Module.ccall("js_save", "number", [], []);
+      if (size <= 0) return;
+      var ptr = Module.ccall("js_save_ptr", "number", [], []);
+      var blob = new Blob([Module.HEAPU8.slice(ptr, ptr + size)], { type: "application/octet-stream" });
+
+      var link = document.createElement("a");
+      link.href = URL.createObjectURL(blob);
+      link.download = "minesweeper.mssv";
+      link.click();
+      setTimeout(function () {
+        URL.revokeObjectURL(link.href);
+      }, 0);
+    } catch (err) {
+      console.error("Error calling js_save:", err);
+    }
+  }
+
+  /**
+   * @brief Resumes the game stored in the chosen file
+   * @param {Event} e Change event of the hidden file input
+   *
+   * The file is copied into the WASM heap once and restored there without parsing.
+   */
+  function handleLoadFile(e) {
+    var file = e.target.files && e.target.files[0];
+    e.target.value = ""; // Choosing the same file again still fires
+    if (!file || !runtimeReady) return;
+
+    file.arrayBuffer().then(function (buffer) {
+      var bytes = new Uint8Array(buffer);
+      var ptr = Module._malloc(Math.max(bytes.length, 1));
+      try {
+        Module.HEAPU8.set(bytes, ptr);
+        if (Module.clearOutput) Module.clearOutput();
+        if (!Module.ccall("js_load", "number", ["number", "number"], [ptr, bytes.length])) return;
+        gameInitialized = true;
+        drawn = null;
+        updateStatus();
+        scheduleRender(true);
+      } catch (err) {
+        console.error("Error calling js_load:", err);
+      } finally {
+        Module._free(ptr);
+      }
+    });
+  }
+
   /**
    * @brief Handles game initialization with user-specified dimensions
    */
@@ -175,17 +345,27 @@ Module.onAbort = function (msg) {
 
     var cols = parseInt(colsEl && colsEl.value ? colsEl.value : "10", 10);
     var rows = parseInt(rowsEl && rowsEl.value ? rowsEl.value : "10", 10);
+    // Optional seed (0 or empty = random board), passed as text: printed seeds use all 64 bits,
+    // more than a JS number holds exactly
+    var seed = seedEl && seedEl.value ? seedEl.value.trim() : "";
+    var noGuess = noGuessEl && noGuessEl.checked ? 1 : 0;
 
     if (!(cols > 1 && rows > 1)) {
       writeTo(outputEl, "Invalid sizes. Use numbers greater than 1.\n");
       return;
     }
+    if (seed !== "" && !(/^[0-9]{1,20}$/.test(seed) && BigInt(seed) <= BigInt("18446744073709551615"))) {
+      writeTo(outputEl, "Invalid seed. Use a whole number from 0 to 18446744073709551615.\n");
+      return;
+    }
 
     try {
       if (Module.clearOutput) Module.clearOutput();
-      Module.ccall("js_init", "void", ["number", "number"], [cols, rows]);
+      Module.ccall("js_init", "void", ["number", "number", "string", "number"], [cols, rows, seed, noGuess]);
       gameInitialized = true;
+      drawn = null; // The previous board's buffer is gone; clicks wait for the first frame
       updateStatus();
+      scheduleRender(true);
       try {
         inputEl.focus();
       } catch (e) {}
@@ -195,65 +375,351 @@ Module.onAbort = function (msg) {
   }
 
   // ===================================================================
-  // * Board Rendering and Color System
+  // * Board Rendering
   // ===================================================================
 
+  // Cell byte layout shared with C++ (see Cell.h and js_view_ptr in web_bindings.cpp)
+  var COUNT_MASK = 0x0f;
+  var STATE_SHIFT = 4;
+  var CONTENT_SHIFT = 6;
+  var STATE_REVEALED = 1;
+  var STATE_FLAGGED = 2;
+  var CONTENT_MINE = 2;
+
+  var GLYPH_MIN_CELL = 14; ///< Smallest cell (px) drawn with numbers; below it one pixel per cell
+  var GLYPH_MAX_CELLS = 40000; ///< Larger boards always use the pixel renderer
+  var GLYPH_MAX_CELL = 28; ///< Largest cell (px)
+
+  var COLORS = {
+    hidden: "#2a2b31",
+    revealed: "#101114",
+    flag: "#ffd166",
+    mine: "#ef4444",
+    label: "#ffd166",
+    text: "#e6eef7",
+    numbers: ["", "#3b82f6", "#22c55e", "#ef4444", "#1d4ed8", "#b91c1c", "#14b8a6", "#6b7280", "#9ca3af"],
+  };
+
+  var framePending = false; ///< A redraw is already queued for the next animation frame
+  var pixelPalettes = null; ///< [playing, lost] RGBA colour per cell byte, as Uint32Array(256)
+  var pixelImage = null; ///< ImageData reused while the board size stays the same
+  var pendingCells = []; ///< Cell offsets changed since the last frame (from js_changes_ptr)
+  var fullRedraw = true; ///< The next frame must draw every cell
+  var drawn = null; ///< Layout of the last frame: {ptr, columns, rows, size, lost, left, top, cell}
+
   /**
-   * @brief Escapes HTML special characters to prevent XSS
-   * @param {string} s The input string to escape
-   * @return {string} HTML-safe escaped string
+   * @brief Parses "#rrggbb" into a pixel value for a Uint32Array over ImageData
+   * @param {string} hex Colour
+   * @return {number} RGBA packed in the platform's byte order
    */
-  function escapeHtml(s) {
-    return s.replace(/&/g, "&amp;").replace(/</g, "&lt;").replace(/>/g, "&gt;");
+  function packColor(hex) {
+    var bytes = new Uint8Array([
+      parseInt(hex.slice(1, 3), 16),
+      parseInt(hex.slice(3, 5), 16),
+      parseInt(hex.slice(5, 7), 16),
+      255,
+    ]);
+    return new Uint32Array(bytes.buffer)[0];
   }
 
   /**
-   * @brief Detects if text contains minesweeper board content
-   * @param {string} text The text to analyze
-   * @return {boolean} True if text appears to contain board elements
+   * @brief Builds the byte -> pixel tables once, so drawing a cell is one lookup
+   *
+   * The second table is used once the game is lost and also shows hidden mines.
    */
-  function isBoardish(text) {
-    // Detects game board patterns: numbers, cells, borders, labels
-    return /(\s[1-8]\s)|(\s[#\*\|]\s)|(^(?:\s{1,2}\d{1,2})(?=\s*\|))|(\s[+\-]\s)/m.test(
-      text
-    );
+  function buildPixelPalettes() {
+    var playing = new Uint32Array(256);
+    var lost = new Uint32Array(256);
+    var numbers = COLORS.numbers.map(function (c) {
+      return c ? packColor(c) : packColor(COLORS.revealed);
+    });
+
+    for (var b = 0; b < 256; b++) {
+      var state = (b >> STATE_SHIFT) & 3;
+      var mine = b >> CONTENT_SHIFT === CONTENT_MINE;
+      var color;
+
+      if (state === STATE_FLAGGED) color = packColor(COLORS.flag);
+      else if (state !== STATE_REVEALED) color = packColor(COLORS.hidden);
+      else if (mine) color = packColor(COLORS.mine);
+      else color = numbers[(b & COUNT_MASK) % 9];
+
+      playing[b] = color;
+      lost[b] = mine && state !== STATE_FLAGGED ? packColor(COLORS.mine) : color;
+    }
+
+    pixelPalettes = [playing, lost];
   }
 
   /**
-   * @brief Applies color styling to board text using CSS classes
-   * @param {string} text The raw board text from C++
-   * @return {string} HTML with colored spans for numbers and labels
+   * @brief Converts a 0-based column index to its spreadsheet label (A..Z, AA, AB, ...)
+   * @param {number} column Column index
+   * @return {string} Label
    */
-  function decorateBoardText(text) {
-    var html = escapeHtml(text);
+  function columnLabel(column) {
+    var label = "";
+    for (var n = column + 1; n > 0; n = Math.floor((n - 1) / 26)) {
+      label = String.fromCharCode(65 + ((n - 1) % 26)) + label;
+    }
+    return label;
+  }
 
-    // Color mine count numbers (1-8) with appropriate CSS classes
-    html = html.replace(
-      /(\s)([1-8])(\s)/g,
-      '$1<span class="num$2">$2</span>$3'
-    );
+  /**
+   * @brief Draws one pixel per cell through a reused ImageData; CSS scales it
+   * @param {Uint8Array} cells Board cells
+   * @param {number} columns Board width
+   * @param {number} rows Board height
+   * @param {boolean} lost Show every mine
+   * @param {Array<number>|null} changed Offsets to redraw, or null for every cell
+   */
+  function drawPixels(cells, columns, rows, lost, changed) {
+    if (!pixelPalettes) buildPixelPalettes();
+    var palette = pixelPalettes[lost ? 1 : 0];
+
+    if (changed) {
+      // Only the bounding box of the changed cells is uploaded
+      var pixels = new Uint32Array(pixelImage.data.buffer);
+      var minX = columns, minY = rows, maxX = -1, maxY = -1;
+      for (var k = 0; k < changed.length; k++) {
+        var i = changed[k];
+        var x = i % columns;
+        var y = (i - x) / columns;
+        pixels[i] = palette[cells[i]];
+        if (x < minX) minX = x;
+        if (x > maxX) maxX = x;
+        if (y < minY) minY = y;
+        if (y > maxY) maxY = y;
+      }
+      if (maxX >= 0) canvasCtx.putImageData(pixelImage, 0, 0, minX, minY, maxX - minX + 1, maxY - minY + 1);
+      return;
+    }
+
+    if (canvasEl.width !== columns || canvasEl.height !== rows) {
+      canvasEl.width = columns;
+      canvasEl.height = rows;
+    }
+    if (!pixelImage || pixelImage.width !== columns || pixelImage.height !== rows) {
+      pixelImage = canvasCtx.createImageData(columns, rows);
+    }
+
+    var all = new Uint32Array(pixelImage.data.buffer);
+    for (var j = 0, n = cells.length; j < n; j++) {
+      all[j] = palette[cells[j]];
+    }
+    canvasCtx.putImageData(pixelImage, 0, 0);
+
+    // Fill the available width, never shrinking a cell below one pixel
+    var scale = Math.max(1, (boardWrapEl.clientWidth - 24) / columns);
+    canvasEl.style.width = Math.floor(columns * scale) + "px";
+    canvasEl.style.height = Math.floor(rows * scale) + "px";
+    canvasEl.dataset.cell = scale;
+  }
 
-    // Color row labels on the left side of the board
-    html = html.replace(
-      /^(\s{1,})(\d{1,2})(?=\s*\|)/gm,
-      function (_m, sp, num) {
-        return sp + '<span class="label">' + num + "</span>";
+  /**
+   * @brief Draws one labelled-board cell with its glyph
+   * @param {number} b Cell byte
+   * @param {number} x Left edge in pixels
+   * @param {number} y Top edge in pixels
+   * @param {number} size Cell size in pixels
+   * @param {boolean} lost Show the cell's mine, if any
+   */
+  function drawGlyphCell(b, x, y, size, lost) {
+    var ctx = canvasCtx;
+    var state = (b >> STATE_SHIFT) & 3;
+    var mine = b >> CONTENT_SHIFT === CONTENT_MINE;
+    var glyph = "";
+    var glyphColor = COLORS.text;
+
+    if (state === STATE_REVEALED || (lost && mine && state !== STATE_FLAGGED)) {
+      ctx.fillStyle = mine ? COLORS.mine : COLORS.revealed;
+      if (mine) {
+        glyph = "*";
+        glyphColor = COLORS.revealed;
+      } else if (b & COUNT_MASK) {
+        glyph = String(b & COUNT_MASK);
+        glyphColor = COLORS.numbers[b & COUNT_MASK];
       }
-    );
+    } else {
+      ctx.fillStyle = COLORS.hidden;
+      if (state === STATE_FLAGGED) {
+        glyph = "F";
+        glyphColor = COLORS.flag;
+      }
+    }
+
+    ctx.fillRect(x + 1, y + 1, size - 2, size - 2);
+    if (glyph) {
+      ctx.fillStyle = glyphColor;
+      ctx.fillText(glyph, x + size / 2, y + size / 2 + 1);
+    }
+  }
+
+  /**
+   * @brief Draws labelled cells with their numbers (small boards only)
+   * @param {Uint8Array} cells Board cells
+   * @param {number} columns Board width
+   * @param {number} rows Board height
+   * @param {boolean} lost Show every mine
+   * @param {number} size Cell size in pixels
+   * @param {Array<number>|null} changed Offsets to redraw, or null for the whole board
+   */
+  function drawGlyphs(cells, columns, rows, lost, size, changed) {
+    var left = size * 2;
+    var top = size;
+    var ctx = canvasCtx;
+
+    if (changed) {
+      for (var k = 0; k < changed.length; k++) {
+        var i = changed[k];
+        var x = i % columns;
+        drawGlyphCell(cells[i], left + x * size, top + ((i - x) / columns) * size, size, lost);
+      }
+      return;
+    }
 
-    return html;
+    var width = left + columns * size;
+    var height = top + rows * size;
+    if (canvasEl.width !== width || canvasEl.height !== height) {
+      canvasEl.width = width;
+      canvasEl.height = height;
+    }
+    canvasEl.style.width = width + "px";
+    canvasEl.style.height = height + "px";
+    canvasEl.dataset.cell = size;
+
+    ctx.clearRect(0, 0, width, height);
+    ctx.font = Math.floor(size * 0.6) + "px " + getComputedStyle(document.body).fontFamily;
+    ctx.textAlign = "center";
+    ctx.textBaseline = "middle";
+
+    ctx.fillStyle = COLORS.label;
+    for (var c = 0; c < columns; c++) ctx.fillText(columnLabel(c), left + c * size + size / 2, top / 2);
+    for (var r = 0; r < rows; r++) ctx.fillText(String(r + 1), left / 2, top + r * size + size / 2);
+
+    for (var j = 0, n = cells.length; j < n; j++) {
+      var cx = j % columns;
+      drawGlyphCell(cells[j], left + cx * size, top + ((j - cx) / columns) * size, size, lost);
+    }
   }
 
   /**
-   * @brief Writes text to the terminal output with optional board coloring
+   * @brief Redraws the board straight from the WASM heap
+   *
+   * The cell buffer is read in place through a Uint8Array (no copy, no text);
+   * the view is re-created every frame because both the buffer address (new
+   * game) and the heap's ArrayBuffer (memory growth) can change. When the
+   * layout is unchanged only the cells reported by collectChanges() are
+   * redrawn; a new game, a resize or a loss (which uncovers every mine)
+   * redraws everything.
+   */
+  function renderBoard() {
+    framePending = false;
+    if (!runtimeReady || !canvasEl || !canvasCtx) return;
+
+    var ptr = Module.ccall("js_view_ptr", "number", [], []);
+    if (!ptr) return;
+
+    var st = readStatus();
+    var columns = Module.ccall("js_view_stride", "number", [], []);
+    var rows = st.rows;
+    var lost = st.state === 2;
+    var cells = new Uint8Array(Module.HEAPU8.buffer, ptr, columns * rows);
+
+    var available = boardWrapEl.clientWidth - 24;
+    var size = Math.min(GLYPH_MAX_CELL, Math.floor(available / (columns + 2)));
+    var glyphs = size >= GLYPH_MIN_CELL && columns * rows <= GLYPH_MAX_CELLS;
+    if (!glyphs) size = 0;
+
+    var same =
+      !fullRedraw &&
+      drawn &&
+      drawn.ptr === ptr &&
+      drawn.columns === columns &&
+      drawn.rows === rows &&
+      drawn.size === size &&
+      drawn.lost === lost;
+    var changed = same ? pendingCells : null;
+
+    if (glyphs) {
+      drawGlyphs(cells, columns, rows, lost, size, changed);
+    } else {
+      drawPixels(cells, columns, rows, lost, changed);
+    }
+
+    drawn = {
+      ptr: ptr,
+      columns: columns,
+      rows: rows,
+      size: size,
+      lost: lost,
+      left: glyphs ? size * 2 : 0, // Canvas pixels before the first column (row labels)
+      top: glyphs ? size : 0, // Canvas pixels above the first row (column labels)
+      cell: glyphs ? size : 1, // Canvas pixels per cell
+    };
+    pendingCells = [];
+    fullRedraw = false;
+  }
+
+  /**
+   * @brief Queues a redraw for the next animation frame (several calls share one)
+   * @param {boolean} [full] Redraw every cell instead of the collected changes
+   */
+  function scheduleRender(full) {
+    if (full === true) fullRedraw = true;
+    if (framePending) return;
+    framePending = true;
+    window.requestAnimationFrame(renderBoard);
+  }
+
+  /**
+   * @brief Reads the cells changed by the last call into WASM and queues them for the next frame
+   *
+   * Must run right after js_submit / js_submit_batch: the next call restarts
+   * the list. Each record is 8 bytes, a uint32 offset then a reason byte
+   * (see CellChange.h). Large changes fall back to a full redraw.
+   */
+  function collectChanges() {
+    var count = Module.ccall("js_changes_count", "number", [], []);
+    if (count === 0) return;
+
+    var st = readStatus();
+    if (fullRedraw || pendingCells.length + count > (st.columns * st.rows) / 4) {
+      fullRedraw = true;
+      pendingCells = [];
+    } else {
+      var records = new Uint32Array(Module.HEAPU8.buffer, Module.ccall("js_changes_ptr", "number", [], []), count * 2);
+      for (var i = 0; i < count; i++) pendingCells.push(records[i * 2]);
+    }
+    scheduleRender();
+  }
+
+  /** @brief Lets other scripts (replays, bots) request a full redraw after driving the game */
+  Module.renderBoard = function () {
+    scheduleRender(true);
+  };
+
+  // ===================================================================
+  // * Terminal Output
+  // ===================================================================
+
+  /**
+   * @brief Escapes HTML special characters to prevent XSS
+   * @param {string} s The input string to escape
+   * @return {string} HTML-safe escaped string
+   */
+  function escapeHtml(s) {
+    return s.replace(/&/g, "&amp;").replace(/</g, "&lt;").replace(/>/g, "&gt;");
+  }
+
+  /**
+   * @brief Writes text to the terminal output
    * @param {HTMLElement} out The output element to write to
    * @param {string} text The text content to display
    */
   function writeTo(out, text) {
     if (!out) return;
 
-    var html = isBoardish(text) ? decorateBoardText(text) : escapeHtml(text);
-    out.innerHTML += html;
+    out.innerHTML += escapeHtml(text);
     out.scrollTop = out.scrollHeight;
   }
 
@@ -261,37 +727,82 @@ Module.onAbort = function (msg) {
   // * Game Status Management
   // ===================================================================
 
+  // Field order of GameStatus (include/GameStatus.h), all int32
+  var STATUS_FIELDS = [
+    "columns",
+    "rows",
+    "mines",
+    "flags",
+    "revealed",
+    "state",
+    "moves",
+    "elapsedMs",
+    "lastRevealed",
+    "threeBV",
+  ];
+
+  /**
+   * @brief Reads the whole game status with one call into WASM
+   * @return {Object} One property per GameStatus field
+   */
+  function readStatus() {
+    var ptr = Module.ccall("js_status", "number", [], []);
+    var fields = new Int32Array(Module.HEAP32.buffer, ptr, STATUS_FIELDS.length);
+    var status = {};
+    for (var i = 0; i < STATUS_FIELDS.length; i++) status[STATUS_FIELDS[i]] = fields[i];
+    return status;
+  }
+
+  /**
+   * @brief Formats milliseconds as m:ss
+   * @param {number} ms Elapsed time
+   * @return {string} Clock text
+   */
+  function formatClock(ms) {
+    var seconds = Math.floor(ms / 1000);
+    var rest = seconds % 60;
+    return Math.floor(seconds / 60) + ":" + (rest < 10 ? "0" : "") + rest;
+  }
+
   /**
    * @brief Updates the status panel with current game statistics
    *
-   * Retrieves game state from C++ via ccall and updates the DOM elements
-   * displaying board size, mine count, flags placed, cells revealed, and game state.
+   * Reads the GameStatus struct from C++ in a single call and updates the
+   * DOM elements displaying board size, mines, flags, revealed cells, moves,
+   * time, 3BV and game state. While a game is running the clock keeps
+   * ticking through a one-second timer.
    */
   function updateStatus() {
     if (!runtimeReady) return;
 
     try {
-      var C = Module.ccall("js_status_columns", "number", [], []);
-      var R = Module.ccall("js_status_rows", "number", [], []);
-      var M = Module.ccall("js_status_mines_total", "number", [], []);
-      var F = Module.ccall("js_status_flags", "number", [], []);
-      var RV = Module.ccall("js_status_revealed", "number", [], []);
-      var S = Module.ccall("js_status_state", "number", [], []);
-
-      if (stSize) stSize.textContent = "Size: " + (C || 0) + "x" + (R || 0);
-      if (stMines) stMines.textContent = "Mines: " + (M || 0);
-      if (stFlags) stFlags.textContent = "Flags: " + (F || 0);
-      if (stRevealed) stRevealed.textContent = "Revealed: " + (RV || 0);
+      var st = readStatus();
+
+      if (stSize) stSize.textContent = "Size: " + st.columns + "x" + st.rows;
+      if (stMines) stMines.textContent = "Mines: " + st.mines;
+      if (stFlags) stFlags.textContent = "Flags: " + st.flags;
+      if (stRevealed) stRevealed.textContent = "Revealed: " + st.revealed;
+      if (stMoves) stMoves.textContent = "Moves: " + st.moves;
+      if (stTime) stTime.textContent = "Time: " + formatClock(st.elapsedMs);
+      if (stThreeBV) stThreeBV.textContent = "3BV: " + st.threeBV;
       if (stState) {
-        stState.textContent = "State: " + getGameStateText(S);
+        stState.textContent = "State: " + getGameStateText(st.state);
+      }
+
+      // Keep the clock running only while a started game is in progress
+      if (st.state === 0 && st.moves > 0) {
+        if (!clockTimer) clockTimer = setInterval(updateStatus, 1000);
+      } else if (clockTimer) {
+        clearInterval(clockTimer);
+        clockTimer = null;
       }
 
       // Detect transition to Lost (2) and trigger shake only once per loss
-      if (S === 2 && lastGameState !== 2) {
+      if (st.state === 2 && lastGameState !== 2) {
         triggerShake();
         inputEl.enabled = false;
       }
-      lastGameState = S;
+      lastGameState = st.state;
     } catch (e) {}
   }
 
@@ -313,6 +824,34 @@ Module.onAbort = function (msg) {
     }
   }
 
+  /**
+   * @brief Plays many moves with a single call into WASM (replays, bots)
+   * @param {Array<Array>} moves Moves as [column, row, action], 0-based, action "R", "F" or "C"
+   * @return {Uint8Array} One MoveOutcome code per move (see enums/MoveOutcome.h)
+   */
+  Module.playBatch = function (moves) {
+    var count = moves.length;
+    var movesPtr = Module._malloc(count * 12);
+    var outcomesPtr = Module._malloc(count);
+
+    try {
+      var view = Module.HEAP32.subarray(movesPtr >> 2, (movesPtr >> 2) + count * 3);
+      for (var i = 0; i < count; i++) {
+        view[i * 3] = moves[i][0];
+        view[i * 3 + 1] = moves[i][1];
+        view[i * 3 + 2] = String(moves[i][2] || "R").toUpperCase().charCodeAt(0);
+      }
+
+      Module.ccall("js_submit_batch", "number", ["number", "number", "number"], [movesPtr, count, outcomesPtr]);
+      collectChanges();
+      updateStatus();
+      return Module.HEAPU8.slice(outcomesPtr, outcomesPtr + count);
+    } finally {
+      Module._free(movesPtr);
+      Module._free(outcomesPtr);
+    }
+  };
+
   // ===================================================================
   // * Emscripten Integration
   // ===================================================================
@@ -343,6 +882,9 @@ Module.onAbort = function (msg) {
   Module.onRuntimeInitialized = function () {
     runtimeReady = true;
     ensureElements();
+    window.addEventListener("resize", function () {
+      scheduleRender(true);
+    });
 
     writeTo(
       outputEl,